@@ -0,0 +1,385 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  Arduino.cpp
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Host implementation of the Arduino core functions, Print, Stream, IPAddress and LowPower
+ */
+
+#include "Arduino.h"
+#include "ArduinoLowPower.h"
+#include "NativeHAL.h"
+
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+Serial_ Serial;
+ArduinoLowPowerClass LowPower;
+
+namespace
+{
+    const auto startTime = std::chrono::steady_clock::now();
+    // Time spent in simulated deep sleep, hidden from millis() and micros()
+    std::chrono::steady_clock::duration pausedTime{};
+    uint8_t pinValues[64];
+    // Pins driven low by digitalWrite(), and since when
+    bool heldLow[64];
+    unsigned long lowSinceUs[64];
+    std::atomic<void (*)()> interruptHandlers[64];
+    nativeHal::HeapStats heap = {0, 0, 0};
+    // Simulated soil probe: a slow random walk between wet (700) and dry (1023) plus read noise
+    std::atomic<long> soilLevel{860};
+
+    /**
+     * @brief One conversion of the soil probe, on 10 bits. A spike is a reading anywhere in the
+     *        range, like a bad contact gives.
+     */
+    long soilConversion()
+    {
+        static const long spikePercent = nativeHal::envLong("PLANTKEEPER_SOIL_SPIKES", 0);
+        if (random(100) < spikePercent)
+        {
+            return random(1024);
+        }
+        return constrain(soilLevel + random(-25, 26), 0L, 1023L);
+    }
+
+    void driftSoil()
+    {
+        soilLevel = constrain(soilLevel + random(-2, 3), 700L, 1023L);
+    }
+}
+
+//--------------------------------------------HAL CONTROLS--------------------------------------------
+
+void *nativeHal::heapAlloc(void *ptr, size_t oldSize, size_t newSize)
+{
+    void *result = realloc(ptr, newSize);
+    if (!result)
+    {
+        return nullptr;
+    }
+    heap.current = heap.current - oldSize + newSize;
+    heap.allocations++;
+    if (heap.current > heap.peak)
+    {
+        heap.peak = heap.current;
+    }
+    return result;
+}
+
+void nativeHal::heapFree(void *ptr, size_t size)
+{
+    if (ptr)
+    {
+        free(ptr);
+        heap.current -= size;
+    }
+}
+
+nativeHal::HeapStats nativeHal::heapStats()
+{
+    return heap;
+}
+
+void nativeHal::resetHeapPeak()
+{
+    heap.peak = heap.current;
+    heap.allocations = 0;
+}
+
+const char *nativeHal::env(const char *name, const char *fallback)
+{
+    const char *value = getenv(name);
+    return (value && value[0] != '\0') ? value : fallback;
+}
+
+long nativeHal::envLong(const char *name, long fallback)
+{
+    const char *value = getenv(name);
+    return (value && value[0] != '\0') ? strtol(value, nullptr, 10) : fallback;
+}
+
+//--------------------------------------------CORE FUNCTIONS--------------------------------------------
+
+unsigned long millis()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - startTime - pausedTime)
+        .count();
+}
+
+unsigned long micros()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - startTime - pausedTime)
+        .count();
+}
+
+void nativeHal::pauseClock(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    pausedTime += std::chrono::milliseconds(ms);
+}
+
+void delay(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield()
+{
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    if (pin < sizeof(pinValues) && mode == INPUT_PULLUP)
+    {
+        if (heldLow[pin])
+        {
+            heldLow[pin] = false;
+            nativeHal::dhtStartSignal(pin, micros() - lowSinceUs[pin]);
+        }
+        pinValues[pin] = HIGH;
+    }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    if (pin < sizeof(pinValues))
+    {
+        if (value == LOW && !heldLow[pin])
+        {
+            lowSinceUs[pin] = micros();
+        }
+        heldLow[pin] = value == LOW;
+        pinValues[pin] = value ? HIGH : LOW;
+    }
+}
+
+void attachInterrupt(uint8_t interrupt, void (*handler)(), int mode)
+{
+    (void)mode;
+    if (interrupt < sizeof(pinValues))
+    {
+        interruptHandlers[interrupt] = handler;
+    }
+}
+
+void detachInterrupt(uint8_t interrupt)
+{
+    if (interrupt < sizeof(pinValues))
+    {
+        interruptHandlers[interrupt] = nullptr;
+    }
+}
+
+void nativeHal::raiseInterrupt(uint8_t pin)
+{
+    void (*handler)() = pin < sizeof(pinValues) ? interruptHandlers[pin].load() : nullptr;
+    if (handler)
+    {
+        handler();
+    }
+}
+
+int digitalRead(uint8_t pin)
+{
+    return pin < sizeof(pinValues) ? pinValues[pin] : LOW;
+}
+
+int analogRead(uint8_t pin)
+{
+    (void)pin;
+    driftSoil();
+    return (int)soilConversion();
+}
+
+void nativeHal::adcFreeRun(uint8_t pin, volatile uint16_t *ring, size_t size)
+{
+    (void)pin;
+    std::thread([ring, size]() {
+        std::chrono::steady_clock::time_point result = std::chrono::steady_clock::now();
+        for (size_t slot = 0;; slot = (slot + 1) % size)
+        {
+            result += std::chrono::microseconds(26600);
+            std::this_thread::sleep_until(result);
+            // The soil drifts about as fast as when it was read every 2 s
+            if (random(75) == 0)
+            {
+                driftSoil();
+            }
+            // The board averages 64 conversions, the sum of 4 noisy ones gives the 12-bit scale
+            long sum = 0;
+            for (int i = 0; i < 4; i++)
+            {
+                sum += soilConversion();
+            }
+            ring[slot] = (uint16_t)sum;
+        }
+    }).detach();
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax)
+{
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+long random(long max)
+{
+    return max <= 0 ? 0 : ::random() % max;
+}
+
+long random(long min, long max)
+{
+    return min >= max ? min : min + random(max - min);
+}
+
+void randomSeed(unsigned long seed)
+{
+    srandom((unsigned int)seed);
+}
+
+size_t Serial_::write(uint8_t c)
+{
+    return fwrite(&c, 1, 1, stdout);
+}
+
+size_t Serial_::write(const uint8_t *buffer, size_t size)
+{
+    return fwrite(buffer, 1, size, stdout);
+}
+
+void Serial_::flush()
+{
+    fflush(stdout);
+}
+
+//--------------------------------------------PRINT AND STREAM--------------------------------------------
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+    size_t n = 0;
+    while (size--)
+    {
+        if (write(*buffer++) == 0)
+        {
+            break;
+        }
+        n++;
+    }
+    return n;
+}
+
+size_t Print::print(long value, int base)
+{
+    // Formatted on the stack like the SAMD core so printing never shows up in the heap statistics
+    char buf[34];
+    int n = snprintf(buf, sizeof(buf), base == HEX ? "%lx" : (base == OCT ? "%lo" : "%ld"), value);
+    return write(buf, (size_t)n);
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+    char buf[34];
+    int n = snprintf(buf, sizeof(buf), base == HEX ? "%lx" : (base == OCT ? "%lo" : "%lu"), value);
+    return write(buf, (size_t)n);
+}
+
+size_t Print::print(double value, int digits)
+{
+    char buf[40];
+    int n = snprintf(buf, sizeof(buf), "%.*f", digits, value);
+    return write(buf, (size_t)n);
+}
+
+int Stream::timedRead()
+{
+    unsigned long start = millis();
+    do
+    {
+        int c = read();
+        if (c >= 0)
+        {
+            return c;
+        }
+        yield();
+    } while (millis() - start < streamTimeout);
+    return -1;
+}
+
+size_t Stream::readBytes(char *buffer, size_t length)
+{
+    size_t count = 0;
+    while (count < length)
+    {
+        int c = timedRead();
+        if (c < 0)
+        {
+            break;
+        }
+        buffer[count++] = (char)c;
+    }
+    return count;
+}
+
+//--------------------------------------------IPADDRESS--------------------------------------------
+
+IPAddress::IPAddress(uint32_t address)
+{
+    memcpy(bytes, &address, sizeof(bytes));
+}
+
+bool IPAddress::fromString(const char *address)
+{
+    struct in_addr parsed;
+    if (inet_pton(AF_INET, address, &parsed) != 1)
+    {
+        return false;
+    }
+    memcpy(bytes, &parsed.s_addr, sizeof(bytes));
+    return true;
+}
+
+bool IPAddress::operator==(const IPAddress &other) const
+{
+    return memcmp(bytes, other.bytes, sizeof(bytes)) == 0;
+}
+
+uint32_t IPAddress::raw() const
+{
+    uint32_t address;
+    memcpy(&address, bytes, sizeof(address));
+    return address;
+}
+
+String IPAddress::toString() const
+{
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+    return String(buf);
+}
+
+size_t IPAddress::printTo(Print &p) const
+{
+    char buf[16];
+    int n = snprintf(buf, sizeof(buf), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+    return p.write(buf, (size_t)n);
+}
@@ -0,0 +1,106 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  Arduino.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Host stand-in for the Arduino core used by the `native` environment. Timing comes from the
+ *        monotonic clock, pins are kept in memory and the analog input behaves like the soil probe.
+ */
+
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <math.h>
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "IPAddress.h"
+#include "Client.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define LED_BUILTIN 6
+// Clock of the SAMD21, host timings are expressed in board cycles with it
+#define F_CPU 48000000L
+#define A0 15
+
+#define PROGMEM
+#define PGM_P const char *
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+#define CHANGE 2
+#define FALLING 3
+#define RISING 4
+#define digitalPinToInterrupt(pin) (pin)
+
+/**
+ * @brief The handler is called from the thread of the simulated device, like an interrupt it can
+ *        run in the middle of loop()
+ */
+void attachInterrupt(uint8_t interrupt, void (*handler)(), int mode);
+void detachInterrupt(uint8_t interrupt);
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+/**
+ * @brief Serial port writing to the process standard output
+ */
+class Serial_ : public Stream
+{
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    void end() {}
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    void flush() override;
+    operator bool() { return true; }
+};
+
+extern Serial_ Serial;
+
+#endif
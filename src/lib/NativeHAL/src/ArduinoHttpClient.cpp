@@ -0,0 +1,345 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  ArduinoHttpClient.cpp
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Host implementation of the HttpClient stand-in
+ */
+
+#include "ArduinoHttpClient.h"
+#include "NativeHAL.h"
+
+#include <cstdio>
+#include <strings.h>
+
+HttpClient::HttpClient(Client &aClient, const char *aServerName, uint16_t aServerPort)
+    : iClient(&aClient), iServerName(aServerName), iServerPort(aServerPort)
+{
+    iServerOverride[0] = '\0';
+}
+
+HttpClient::HttpClient(Client &aClient, const IPAddress &aServerAddress, uint16_t aServerPort)
+    : iClient(&aClient), iServerAddress(aServerAddress), iServerPort(aServerPort)
+{
+    // PLANTKEEPER_SERVER=host:port points the uplink at a local receiver without rebuilding
+    const char *target = nativeHal::env("PLANTKEEPER_SERVER", nullptr);
+    const char *colon = target ? strrchr(target, ':') : nullptr;
+    if (colon && (size_t)(colon - target) < sizeof(iServerOverride))
+    {
+        memcpy(iServerOverride, target, colon - target);
+        iServerOverride[colon - target] = '\0';
+        iServerName = iServerOverride;
+        iServerPort = (uint16_t)atoi(colon + 1);
+    }
+    else
+    {
+        iServerOverride[0] = '\0';
+    }
+}
+
+void HttpClient::beginRequest()
+{
+    iState = eRequestStarted;
+}
+
+int HttpClient::startRequest(const char *aURLPath, const char *aHttpMethod, const char *aContentType,
+                             int aContentLength, const byte aBody[])
+{
+    bool hasBegun = iState == eRequestStarted;
+    if (iState == eReadingHeaders || iState == eReadingBody)
+    {
+        flushBody();
+    }
+    else if (iState != eIdle && !hasBegun)
+    {
+        return HTTP_ERROR_API;
+    }
+
+    if (iConnectionClose || !iClient->connected())
+    {
+        int connected = iServerName ? iClient->connect(iServerName, iServerPort)
+                                    : iClient->connect(iServerAddress, iServerPort);
+        if (connected <= 0)
+        {
+            iState = eIdle;
+            return HTTP_ERROR_CONNECTION_FAILED;
+        }
+    }
+
+    iClient->print(aHttpMethod);
+    iClient->print(" ");
+    iClient->print(aURLPath);
+    iClient->println(" HTTP/1.1");
+    if (iSendDefaultRequestHeaders)
+    {
+        if (iServerName)
+        {
+            sendHeader("Host", iServerName);
+        }
+        sendHeader("User-Agent", "Arduino/2.2.0");
+    }
+    if (iConnectionClose)
+    {
+        sendHeader("Connection", "close");
+    }
+    if (aContentType)
+    {
+        sendHeader("Content-Type", aContentType);
+    }
+    if (aContentLength >= 0)
+    {
+        sendHeader("Content-Length", aContentLength);
+    }
+
+    iState = eRequestStarted;
+    if (!hasBegun)
+    {
+        finishHeaders();
+        if (aBody && aContentLength > 0)
+        {
+            iClient->write(aBody, aContentLength);
+        }
+        iState = eRequestSent;
+    }
+    return HTTP_SUCCESS;
+}
+
+int HttpClient::post(const char *aURLPath, const char *aContentType, const char *aBody)
+{
+    return startRequest(aURLPath, "POST", aContentType, (int)strlen(aBody), (const byte *)aBody);
+}
+
+void HttpClient::sendHeader(const char *aHeader)
+{
+    iClient->println(aHeader);
+}
+
+void HttpClient::sendHeader(const char *aHeaderName, const char *aHeaderValue)
+{
+    iClient->print(aHeaderName);
+    iClient->print(": ");
+    iClient->println(aHeaderValue);
+}
+
+void HttpClient::sendHeader(const String &aHeaderName, const String &aHeaderValue)
+{
+    sendHeader(aHeaderName.c_str(), aHeaderValue.c_str());
+}
+
+void HttpClient::sendHeader(const char *aHeaderName, const int aHeaderValue)
+{
+    iClient->print(aHeaderName);
+    iClient->print(": ");
+    iClient->println(aHeaderValue);
+}
+
+void HttpClient::finishHeaders()
+{
+    iClient->println();
+}
+
+void HttpClient::beginBody()
+{
+    if (iState == eRequestStarted)
+    {
+        finishHeaders();
+        iState = eRequestSent;
+    }
+}
+
+void HttpClient::endRequest()
+{
+    beginBody();
+}
+
+int HttpClient::readLine(char *line, size_t size)
+{
+    size_t length = 0;
+    unsigned long start = millis();
+    while (millis() - start < iHttpResponseTimeout)
+    {
+        int c = iClient->read();
+        if (c < 0)
+        {
+            if (!iClient->connected())
+            {
+                return -1;
+            }
+            delay(1);
+            continue;
+        }
+        if (c == '\n')
+        {
+            line[length] = '\0';
+            return (int)length;
+        }
+        if (c != '\r' && length + 1 < size)
+        {
+            line[length++] = (char)c;
+        }
+    }
+    return -1;
+}
+
+int HttpClient::responseStatusCode()
+{
+    if (iState != eRequestSent)
+    {
+        return HTTP_ERROR_API;
+    }
+    char line[128];
+    int statusCode;
+    do
+    {
+        if (readLine(line, sizeof(line)) < 0)
+        {
+            iState = eIdle;
+            return iClient->connected() ? HTTP_ERROR_TIMED_OUT : HTTP_ERROR_CONNECTION_FAILED;
+        }
+        if (sscanf(line, "HTTP/%*d.%*d %d", &statusCode) != 1)
+        {
+            iState = eIdle;
+            return HTTP_ERROR_INVALID_RESPONSE;
+        }
+        if (statusCode == 100)
+        {
+            // Skip the empty line ending the interim response
+            readLine(line, sizeof(line));
+        }
+    } while (statusCode == 100);
+
+    iState = eReadingHeaders;
+    iContentLength = kNoContentLengthHeader;
+    iBodyLengthConsumed = 0;
+    return statusCode;
+}
+
+int HttpClient::skipResponseHeaders()
+{
+    char line[128];
+    while (iState == eReadingHeaders)
+    {
+        int length = readLine(line, sizeof(line));
+        if (length < 0)
+        {
+            iState = eIdle;
+            return HTTP_ERROR_TIMED_OUT;
+        }
+        if (length == 0)
+        {
+            iState = eReadingBody;
+        }
+        else if (strncasecmp(line, "Content-Length:", 15) == 0)
+        {
+            iContentLength = atoi(line + 15);
+        }
+    }
+    return iState == eReadingBody ? HTTP_SUCCESS : HTTP_ERROR_API;
+}
+
+int HttpClient::contentLength()
+{
+    skipResponseHeaders();
+    return iContentLength;
+}
+
+bool HttpClient::endOfBodyReached()
+{
+    if (iState != eReadingBody)
+    {
+        return false;
+    }
+    if (iContentLength != kNoContentLengthHeader)
+    {
+        return iBodyLengthConsumed >= iContentLength;
+    }
+    return !iClient->connected() && iClient->available() == 0;
+}
+
+String HttpClient::responseBody()
+{
+    if (skipResponseHeaders() != HTTP_SUCCESS)
+    {
+        return String();
+    }
+    String body;
+    if (iContentLength > 0)
+    {
+        body.reserve(iContentLength);
+    }
+    unsigned long start = millis();
+    while (!endOfBodyReached() && millis() - start < iHttpResponseTimeout)
+    {
+        int c = read();
+        if (c < 0)
+        {
+            delay(1);
+            continue;
+        }
+        body += (char)c;
+    }
+    if (endOfBodyReached())
+    {
+        iState = eIdle;
+    }
+    return body;
+}
+
+void HttpClient::flushBody()
+{
+    skipResponseHeaders();
+    while (iState == eReadingBody && !endOfBodyReached() && read() >= 0)
+    {
+    }
+    iState = eIdle;
+}
+
+size_t HttpClient::write(uint8_t b)
+{
+    return iClient->write(b);
+}
+
+size_t HttpClient::write(const uint8_t *buf, size_t size)
+{
+    return iClient->write(buf, size);
+}
+
+int HttpClient::available()
+{
+    return iClient->available();
+}
+
+int HttpClient::read()
+{
+    int c = iClient->read();
+    if (c >= 0 && iState == eReadingBody)
+    {
+        iBodyLengthConsumed++;
+    }
+    return c;
+}
+
+int HttpClient::read(uint8_t *buf, size_t size)
+{
+    int n = iClient->read(buf, size);
+    if (n > 0 && iState == eReadingBody)
+    {
+        iBodyLengthConsumed += n;
+    }
+    return n;
+}
+
+void HttpClient::stop()
+{
+    iClient->stop();
+    iState = eIdle;
+}
@@ -0,0 +1,107 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  ArduinoHttpClient.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Host stand-in for the part of ArduinoHttpClient used by the firmware. It keeps the same
+ *        request/response state machine and method names so main.cpp compiles unchanged.
+ */
+
+#ifndef NATIVE_ARDUINOHTTPCLIENT_H
+#define NATIVE_ARDUINOHTTPCLIENT_H
+
+#include "Arduino.h"
+
+static const int HTTP_SUCCESS = 0;
+static const int HTTP_ERROR_CONNECTION_FAILED = -1;
+static const int HTTP_ERROR_API = -2;
+static const int HTTP_ERROR_TIMED_OUT = -3;
+static const int HTTP_ERROR_INVALID_RESPONSE = -4;
+
+class HttpClient : public Client
+{
+public:
+    static const int kNoContentLengthHeader = -1;
+    static const int kHttpPort = 80;
+
+    HttpClient(Client &aClient, const char *aServerName, uint16_t aServerPort = kHttpPort);
+    HttpClient(Client &aClient, const IPAddress &aServerAddress, uint16_t aServerPort = kHttpPort);
+
+    void beginRequest();
+    void endRequest();
+    void beginBody();
+
+    int get(const char *aURLPath) { return startRequest(aURLPath, "GET"); }
+    int post(const char *aURLPath) { return startRequest(aURLPath, "POST"); }
+    int post(const char *aURLPath, const char *aContentType, const char *aBody);
+    int startRequest(const char *aURLPath, const char *aHttpMethod, const char *aContentType = nullptr,
+                     int aContentLength = -1, const byte aBody[] = nullptr);
+
+    void sendHeader(const char *aHeader);
+    void sendHeader(const char *aHeaderName, const char *aHeaderValue);
+    void sendHeader(const String &aHeaderName, const String &aHeaderValue);
+    void sendHeader(const char *aHeaderName, const int aHeaderValue);
+
+    int responseStatusCode();
+    int skipResponseHeaders();
+    bool endOfHeadersReached() { return iState == eReadingBody; }
+    bool endOfBodyReached();
+    int contentLength();
+    String responseBody();
+
+    void connectionKeepAlive() { iConnectionClose = false; }
+    void noDefaultRequestHeaders() { iSendDefaultRequestHeaders = false; }
+    void setHttpResponseTimeout(uint32_t timeout) { iHttpResponseTimeout = timeout; }
+
+    // Client
+    int connect(IPAddress ip, uint16_t port) override { return iClient->connect(ip, port); }
+    int connect(const char *host, uint16_t port) override { return iClient->connect(host, port); }
+    size_t write(uint8_t b) override;
+    size_t write(const uint8_t *buf, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int read(uint8_t *buf, size_t size) override;
+    int peek() override { return iClient->peek(); }
+    void flush() override { iClient->flush(); }
+    void stop() override;
+    uint8_t connected() override { return iClient->connected(); }
+    operator bool() override { return bool(*iClient); }
+
+private:
+    enum tHttpState
+    {
+        eIdle,
+        eRequestStarted,
+        eRequestSent,
+        eReadingHeaders,
+        eReadingBody
+    };
+
+    void finishHeaders();
+    void flushBody();
+    int readLine(char *line, size_t size);
+
+    Client *iClient;
+    const char *iServerName = nullptr;
+    IPAddress iServerAddress;
+    uint16_t iServerPort;
+    char iServerOverride[64];
+    tHttpState iState = eIdle;
+    int iContentLength = kNoContentLengthHeader;
+    int iBodyLengthConsumed = 0;
+    bool iConnectionClose = true;
+    bool iSendDefaultRequestHeaders = true;
+    uint32_t iHttpResponseTimeout = 30000;
+};
+
+#endif
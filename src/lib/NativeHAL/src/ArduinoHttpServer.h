@@ -0,0 +1,23 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  ArduinoHttpServer.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Empty stand-in: the firmware includes ArduinoHttpServer but serves pages with WiFiServer directly
+ */
+
+#ifndef NATIVE_ARDUINOHTTPSERVER_H
+#define NATIVE_ARDUINOHTTPSERVER_H
+
+#include "Arduino.h"
+
+#endif
@@ -0,0 +1,46 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  ArduinoLowPower.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Stand-in for the Arduino Low Power library: the process sleeps for the requested time, and
+ *        as on the SAMD21 millis() does not advance during a deep sleep
+ */
+
+#ifndef NATIVE_ARDUINOLOWPOWER_H
+#define NATIVE_ARDUINOLOWPOWER_H
+
+#include "Arduino.h"
+#include "NativeHAL.h"
+
+class ArduinoLowPowerClass
+{
+public:
+    void idle(int ms)
+    {
+        delay((unsigned long)ms);
+    }
+
+    void sleep(int ms)
+    {
+        nativeHal::pauseClock((unsigned long)ms);
+    }
+
+    void deepSleep(int ms)
+    {
+        nativeHal::pauseClock((unsigned long)ms);
+    }
+};
+
+extern ArduinoLowPowerClass LowPower;
+
+#endif
@@ -0,0 +1,47 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  DHT.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Host stand-in for the Adafruit DHT library. Readings drift slowly around room conditions
+ *        and, like the real driver, a new conversion is only made every 2 seconds.
+ */
+
+#ifndef NATIVE_DHT_H
+#define NATIVE_DHT_H
+
+#include "Arduino.h"
+
+#define DHT11 11
+#define DHT22 22
+
+class DHT
+{
+public:
+    DHT(uint8_t pin, uint8_t type) : pin(pin), type(type) {}
+
+    void begin() {}
+    float readTemperature(bool fahrenheit = false, bool force = false);
+    float readHumidity(bool force = false);
+
+private:
+    void read(bool force);
+
+    uint8_t pin;
+    uint8_t type;
+    unsigned long lastReadTime = 0;
+    bool hasReading = false;
+    float temperature = 22.0f;
+    float humidity = 45.0f;
+};
+
+#endif
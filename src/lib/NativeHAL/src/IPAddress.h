@@ -0,0 +1,48 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  IPAddress.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Host implementation of the Arduino IPv4 address class
+ */
+
+#ifndef NATIVE_IPADDRESS_H
+#define NATIVE_IPADDRESS_H
+
+#include <cstdint>
+#include "Print.h"
+
+class IPAddress : public Printable
+{
+public:
+    IPAddress() : bytes{0, 0, 0, 0} {}
+    IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth) : bytes{first, second, third, fourth} {}
+    explicit IPAddress(uint32_t address);
+
+    bool fromString(const char *address);
+    uint8_t operator[](int index) const { return bytes[index]; }
+    uint8_t &operator[](int index) { return bytes[index]; }
+    bool operator==(const IPAddress &other) const;
+    bool operator!=(const IPAddress &other) const { return !(*this == other); }
+
+    /**
+     * @brief Address in network byte order, as expected by sockaddr_in
+     */
+    uint32_t raw() const;
+    String toString() const;
+    size_t printTo(Print &p) const override;
+
+private:
+    uint8_t bytes[4];
+};
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  NativeFlash.cpp
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief File-backed emulation of the SAMD21 internal flash
+ */
+
+#include "Arduino.h"
+#include "NativeHAL.h"
+
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    const size_t rowSize = 256;
+    const size_t pageSize = 64;
+    // Typical SAMD21 timings, the CPU is stalled while the NVM controller works
+    const unsigned int rowEraseUs = 6000;
+    const unsigned int pageWriteUs = 2500;
+}
+
+const uint8_t *nativeHal::flashRegion(const char *name, size_t size)
+{
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.flash", env("PLANTKEEPER_FLASH_DIR", "."), name);
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0 || ((size_t)info.st_size < size && ftruncate(fd, (off_t)size) != 0))
+    {
+        fprintf(stderr, "flash: cannot open %s\n", path);
+        abort();
+    }
+    void *region = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED)
+    {
+        fprintf(stderr, "flash: cannot map %s\n", path);
+        abort();
+    }
+    return static_cast<const uint8_t *>(region);
+}
+
+void nativeHal::flashErase(const volatile void *address, size_t size)
+{
+    uintptr_t row = (uintptr_t)address & ~(uintptr_t)(rowSize - 1);
+    memset((void *)row, 0xFF, size);
+    delayMicroseconds(rowEraseUs);
+}
+
+void nativeHal::flashProgram(const volatile void *address, const void *data, size_t size)
+{
+    uint8_t *destination = (uint8_t *)address;
+    const uint8_t *source = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+        destination[i] &= source[i];
+    }
+    uintptr_t first = (uintptr_t)address / pageSize;
+    uintptr_t last = ((uintptr_t)address + size - 1) / pageSize;
+    delayMicroseconds((unsigned int)(last - first + 1) * pageWriteUs);
+}
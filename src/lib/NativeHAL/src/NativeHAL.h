@@ -0,0 +1,102 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  NativeHAL.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Controls that only exist in the Linux build: heap accounting and the knobs used to
+ *        drive the simulated hardware from the environment.
+ *
+ *        Environment variables read by the HAL:
+ *          - PLANTKEEPER_HTTP_PORT   port WiFiServer binds instead of the requested one (80 needs root)
+ *          - PLANTKEEPER_SERVER      "host:port" overriding the uplink address given to HttpClient
+ *          - PLANTKEEPER_SSID        network returned by the simulated scan and accepted by WiFi.begin()
+ *          - PLANTKEEPER_PASS        password accepted by WiFi.begin() (any password if unset)
+ *          - PLANTKEEPER_RUN_MS      stop the process after this many milliseconds
+ *          - PLANTKEEPER_LOOP_SLEEP_US  idle time between two loop() calls (default 100)
+ *          - PLANTKEEPER_FLASH_DIR   directory of the files backing the flash regions (default ".")
+ *          - PLANTKEEPER_ASSOC_MS    time the simulated association takes (default 0)
+ *          - PLANTKEEPER_DHCP_MS     extra association time when no static address was set (default 0)
+ *          - PLANTKEEPER_WIFI_DOWN   path of a file whose existence takes the simulated network down
+ *          - PLANTKEEPER_SCAN_MS     time a network scan takes (default 2000, like the NINA module)
+ *          - PLANTKEEPER_DHT_PIN     pin of the simulated DHT that answers start signals (default 2 and
+ *                                    4, the DHT_PIN of the polled and of the captured DHT)
+ *          - PLANTKEEPER_DHT_NOISE   percentage of the DHT transfers with a flipped bit (default 0)
+ *          - PLANTKEEPER_SOIL_SPIKES percentage of the soil probe readings that are spikes (default 0)
+ */
+
+#ifndef NATIVE_HAL_H
+#define NATIVE_HAL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nativeHal
+{
+    /**
+     * @brief Allocation statistics of the String class, the only heap user of the firmware
+     */
+    struct HeapStats
+    {
+        size_t current;
+        size_t peak;
+        uint32_t allocations;
+    };
+
+    void *heapAlloc(void *ptr, size_t oldSize, size_t newSize);
+    void heapFree(void *ptr, size_t size);
+    HeapStats heapStats();
+    void resetHeapPeak();
+
+    /**
+     * @brief Returns the value of an environment variable or a fallback when it is not set
+     */
+    const char *env(const char *name, const char *fallback);
+    long envLong(const char *name, long fallback);
+
+    /**
+     * @brief Sleeps without millis() and micros() advancing, like the SAMD21 whose SysTick stops in
+     *        deep sleep
+     */
+    void pauseClock(unsigned long ms);
+
+    /**
+     * @brief Maps a file-backed flash region. A new region is zero-filled like freshly uploaded
+     *        firmware; erase and program keep the NOR flash semantics (erase sets bits, program
+     *        clears them) and take as long as on the SAMD21.
+     */
+    const uint8_t *flashRegion(const char *name, size_t size);
+    void flashErase(const volatile void *address, size_t size);
+    void flashProgram(const volatile void *address, const void *data, size_t size);
+
+    /**
+     * @brief Calls the handler attached to a pin, if any, as an edge of its signal would
+     */
+    void raiseInterrupt(uint8_t pin);
+
+    /**
+     * @brief Called when a pin held low is released. On the DHT pin, a start signal of 18 ms or
+     *        more is answered like a DHT11 and one of 1 to 10 ms like a DHT22: the falling edges of
+     *        the transfer are raised from a thread with the timing of the real sensor. That thread
+     *        spins between edges, on a single core it can be preempted and a transfer then fails
+     *        like one with a lost edge on the board.
+     */
+    void dhtStartSignal(uint8_t pin, unsigned long lowUs);
+
+    /**
+     * @brief Plays the free-running ADC and its DMA channel: every 26.6 ms, like 64 averaged
+     *        conversions on the SAMD21, a 12-bit soil probe result is written to the next slot of
+     *        the ring, from a thread. The results keep coming while the clock is paused.
+     */
+    void adcFreeRun(uint8_t pin, volatile uint16_t *ring, size_t size);
+}
+
+#endif
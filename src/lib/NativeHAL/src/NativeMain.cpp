@@ -0,0 +1,120 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  NativeMain.cpp
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Entry point of the Linux build: runs setup() once then loop() forever, like the Arduino core.
+ *        The duration of every loop() call is recorded and summarised on exit so the per-cycle
+ *        latency of the firmware can be compared between changes.
+ */
+
+#include "Arduino.h"
+#include "NativeHAL.h"
+
+#include <csignal>
+#include <cstdio>
+#include <ctime>
+#include <unistd.h>
+
+// The tests of test/ have their own main() and no setup() or loop()
+#ifndef PIO_UNIT_TESTING
+
+void setup();
+void loop();
+
+namespace
+{
+    volatile sig_atomic_t stopRequested = 0;
+
+    void requestStop(int)
+    {
+        stopRequested = 1;
+    }
+
+    // loopBuckets[i] counts the loop() calls that took less than 2^i microseconds
+    const int bucketCount = 32;
+    unsigned long loopBuckets[bucketCount];
+    unsigned long loopCount = 0;
+    unsigned long loopMaxUs = 0;
+    unsigned long long loopTotalUs = 0;
+
+    void recordLoop(unsigned long durationUs)
+    {
+        int bucket = 0;
+        while (bucket < bucketCount - 1 && (1UL << bucket) <= durationUs)
+        {
+            bucket++;
+        }
+        loopBuckets[bucket]++;
+        loopCount++;
+        loopTotalUs += durationUs;
+        if (durationUs > loopMaxUs)
+        {
+            loopMaxUs = durationUs;
+        }
+    }
+
+    unsigned long loopPercentile(double fraction)
+    {
+        unsigned long target = (unsigned long)(loopCount * fraction);
+        unsigned long seen = 0;
+        for (int i = 0; i < bucketCount; i++)
+        {
+            seen += loopBuckets[i];
+            if (seen > target)
+            {
+                return 1UL << i;
+            }
+        }
+        return loopMaxUs;
+    }
+
+    void printLoopSummary()
+    {
+        if (loopCount == 0)
+        {
+            return;
+        }
+        fprintf(stderr, "loop(): %lu calls, mean %.1f us, p50 < %lu us, p99 < %lu us, p99.9 < %lu us, max %lu us\n",
+                loopCount, (double)loopTotalUs / loopCount, loopPercentile(0.5), loopPercentile(0.99),
+                loopPercentile(0.999), loopMaxUs);
+    }
+}
+
+int main()
+{
+    signal(SIGINT, requestStop);
+    signal(SIGTERM, requestStop);
+    signal(SIGPIPE, SIG_IGN);
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    randomSeed((unsigned long)time(nullptr) ^ (unsigned long)getpid());
+
+    const long runMs = nativeHal::envLong("PLANTKEEPER_RUN_MS", 0);
+    const long loopSleepUs = nativeHal::envLong("PLANTKEEPER_LOOP_SLEEP_US", 100);
+
+    setup();
+    while (!stopRequested && (runMs <= 0 || millis() < (unsigned long)runMs))
+    {
+        unsigned long start = micros();
+        loop();
+        recordLoop(micros() - start);
+        if (loopSleepUs > 0)
+        {
+            usleep((useconds_t)loopSleepUs);
+        }
+    }
+    Serial.flush();
+    printLoopSummary();
+    return 0;
+}
+
+#endif
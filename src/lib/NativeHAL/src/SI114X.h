@@ -0,0 +1,33 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  SI114X.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Host stand-in for the Grove SI114X sunlight sensor library. The visible channel follows a
+ *        slow day/night cycle inside the 160-800 range observed on the real sensor.
+ */
+
+#ifndef NATIVE_SI114X_H
+#define NATIVE_SI114X_H
+
+#include "Arduino.h"
+
+class SI114X
+{
+public:
+    bool Begin() { return true; }
+    uint16_t ReadVisible();
+    uint16_t ReadIR();
+    uint16_t ReadUV();
+};
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  Sensors.cpp
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Simulated DHT11 and SI1145 sensors
+ */
+
+#include "DHT.h"
+#include "NativeHAL.h"
+#include "SI114X.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    // One simulated day lasts 10 minutes so a soak test sees both dark and bright periods
+    const unsigned long simulatedDayMs = 600000UL;
+
+    // Conditions seen by the DHT answering start signals, drifting like those of the DHT class
+    float transferTemperature = 22.0f;
+    float transferHumidity = 45.0f;
+    std::atomic<bool> transferRunning{false};
+
+    void spinUntil(std::chrono::steady_clock::time_point deadline)
+    {
+        // Sleeping is not precise enough for edges 27 us apart
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+        }
+    }
+
+    /**
+     * @brief Raises the falling edges of a transfer: the response (80 us low, 80 us high), then for
+     *        each bit 50 us low and 27 or 70 us high
+     */
+    void playTransfer(uint8_t pin, const uint8_t *frame)
+    {
+        using std::chrono::microseconds;
+        std::chrono::steady_clock::time_point edge = std::chrono::steady_clock::now() + microseconds(30);
+        spinUntil(edge);
+        nativeHal::raiseInterrupt(pin);
+        edge += microseconds(160);
+        spinUntil(edge);
+        nativeHal::raiseInterrupt(pin);
+        for (int bit = 0; bit < 40; bit++)
+        {
+            bool one = frame[bit / 8] & (0x80 >> (bit % 8));
+            edge += microseconds(one ? 120 : 77);
+            spinUntil(edge);
+            nativeHal::raiseInterrupt(pin);
+        }
+    }
+}
+
+void nativeHal::dhtStartSignal(uint8_t pin, unsigned long lowUs)
+{
+    static const long dhtPin = envLong("PLANTKEEPER_DHT_PIN", -1);
+    static const long noisePercent = envLong("PLANTKEEPER_DHT_NOISE", 0);
+    bool dht11 = lowUs >= 18000;
+    bool dht22 = lowUs >= 1000 && lowUs < 10000;
+    bool onDhtPin = dhtPin < 0 ? pin == 2 || pin == 4 : pin == dhtPin;
+    if (!onDhtPin || (!dht11 && !dht22) || transferRunning)
+    {
+        return;
+    }
+
+    transferTemperature = constrain(transferTemperature + random(-10, 11) / 100.0f, 15.0f, 35.0f);
+    transferHumidity = constrain(transferHumidity + random(-50, 51) / 100.0f, 20.0f, 90.0f);
+    int tenths = (int)lroundf(transferTemperature * 10);
+    int humidityTenths = (int)lroundf(transferHumidity * 10);
+    uint8_t frame[5];
+    if (dht11)
+    {
+        frame[0] = (uint8_t)(humidityTenths / 10);
+        frame[1] = 0;
+        frame[2] = (uint8_t)(tenths / 10);
+        frame[3] = (uint8_t)(tenths % 10);
+    }
+    else
+    {
+        frame[0] = (uint8_t)(humidityTenths >> 8);
+        frame[1] = (uint8_t)humidityTenths;
+        frame[2] = (uint8_t)(tenths >> 8);
+        frame[3] = (uint8_t)tenths;
+    }
+    frame[4] = (uint8_t)(frame[0] + frame[1] + frame[2] + frame[3]);
+    if (random(100) < noisePercent)
+    {
+        frame[random(5)] ^= (uint8_t)(1 << random(8));
+    }
+
+    transferRunning = true;
+    std::thread([pin, frame]() {
+        playTransfer(pin, frame);
+        transferRunning = false;
+    }).detach();
+}
+
+//--------------------------------------------DHT--------------------------------------------
+
+void DHT::read(bool force)
+{
+    unsigned long now = millis();
+    if (hasReading && !force && now - lastReadTime < 2000)
+    {
+        return;
+    }
+    // The DHT11 protocol takes about 5 ms with interrupts disabled
+    delay(5);
+    lastReadTime = now;
+    hasReading = true;
+    temperature = constrain(temperature + random(-10, 11) / 100.0f, 15.0f, 35.0f);
+    humidity = constrain(humidity + random(-50, 51) / 100.0f, 20.0f, 90.0f);
+}
+
+float DHT::readTemperature(bool fahrenheit, bool force)
+{
+    read(force);
+    // DHT11 resolution is 0.1 degree
+    float celsius = roundf(temperature * 10) / 10;
+    return fahrenheit ? celsius * 1.8f + 32 : celsius;
+}
+
+float DHT::readHumidity(bool force)
+{
+    read(force);
+    return roundf(humidity);
+}
+
+//--------------------------------------------SI114X--------------------------------------------
+
+uint16_t SI114X::ReadVisible()
+{
+    float phase = (float)(millis() % simulatedDayMs) / simulatedDayMs;
+    float daylight = sinf(phase * 2 * (float)M_PI);
+    long base = daylight > 0 ? 160 + (long)(daylight * 640) : 160;
+    return (uint16_t)constrain(base + random(-8, 9), 150L, 820L);
+}
+
+uint16_t SI114X::ReadIR()
+{
+    return (uint16_t)(ReadVisible() * 2);
+}
+
+uint16_t SI114X::ReadUV()
+{
+    return (uint16_t)(ReadVisible() / 4);
+}
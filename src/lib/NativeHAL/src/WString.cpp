@@ -0,0 +1,373 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  WString.cpp
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Host implementation of the Arduino String class
+ */
+
+#include "WString.h"
+#include "NativeHAL.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    const char *numberFormat(unsigned char base, bool isSigned)
+    {
+        if (base == 16)
+        {
+            return "%lx";
+        }
+        if (base == 8)
+        {
+            return "%lo";
+        }
+        return isSigned ? "%ld" : "%lu";
+    }
+}
+
+String::String(const char *cstr)
+{
+    concat(cstr);
+}
+
+String::String(const char *cstr, unsigned int length)
+{
+    concat(cstr, length);
+}
+
+String::String(const __FlashStringHelper *str)
+{
+    concat(reinterpret_cast<const char *>(str));
+}
+
+String::String(const String &str)
+{
+    concat(str.c_str(), str.len);
+}
+
+String::String(String &&str) : buffer(str.buffer), capacity(str.capacity), len(str.len)
+{
+    str.buffer = nullptr;
+    str.capacity = 0;
+    str.len = 0;
+}
+
+String::String(char c)
+{
+    concat(c);
+}
+
+String::String(unsigned char value, unsigned char base) : String((unsigned long)value, base) {}
+
+String::String(int value, unsigned char base) : String((long)value, base) {}
+
+String::String(unsigned int value, unsigned char base) : String((unsigned long)value, base) {}
+
+String::String(long value, unsigned char base)
+{
+    char buf[34];
+    snprintf(buf, sizeof(buf), numberFormat(base, true), value);
+    concat(buf);
+}
+
+String::String(unsigned long value, unsigned char base)
+{
+    char buf[34];
+    snprintf(buf, sizeof(buf), numberFormat(base, false), value);
+    concat(buf);
+}
+
+String::String(float value, unsigned char decimalPlaces) : String((double)value, decimalPlaces) {}
+
+String::String(double value, unsigned char decimalPlaces)
+{
+    char buf[40];
+    snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+    concat(buf);
+}
+
+String::~String()
+{
+    nativeHal::heapFree(buffer, capacity);
+}
+
+String &String::operator=(const String &rhs)
+{
+    if (this != &rhs)
+    {
+        len = 0;
+        concat(rhs.c_str(), rhs.len);
+    }
+    return *this;
+}
+
+String &String::operator=(String &&rhs)
+{
+    if (this != &rhs)
+    {
+        nativeHal::heapFree(buffer, capacity);
+        buffer = rhs.buffer;
+        capacity = rhs.capacity;
+        len = rhs.len;
+        rhs.buffer = nullptr;
+        rhs.capacity = 0;
+        rhs.len = 0;
+    }
+    return *this;
+}
+
+String &String::operator=(const char *cstr)
+{
+    len = 0;
+    concat(cstr);
+    return *this;
+}
+
+bool String::grow(unsigned int size)
+{
+    // Same policy as the SAMD core: the buffer is reallocated to the exact size requested
+    if (buffer && capacity >= size + 1)
+    {
+        return true;
+    }
+    char *newBuffer = static_cast<char *>(nativeHal::heapAlloc(buffer, capacity, size + 1));
+    if (!newBuffer)
+    {
+        return false;
+    }
+    if (!buffer)
+    {
+        newBuffer[0] = '\0';
+    }
+    buffer = newBuffer;
+    capacity = size + 1;
+    return true;
+}
+
+bool String::reserve(unsigned int size)
+{
+    return grow(size);
+}
+
+bool String::concat(const char *cstr, unsigned int length)
+{
+    if (!cstr)
+    {
+        return false;
+    }
+    if (!grow(len + length))
+    {
+        return false;
+    }
+    memmove(buffer + len, cstr, length);
+    len += length;
+    buffer[len] = '\0';
+    return true;
+}
+
+bool String::concat(const String &str)
+{
+    return concat(str.c_str(), str.len);
+}
+
+bool String::concat(const char *cstr)
+{
+    return cstr && concat(cstr, strlen(cstr));
+}
+
+bool String::concat(char c)
+{
+    return concat(&c, 1);
+}
+
+bool String::concat(int value)
+{
+    return concat(String(value));
+}
+
+bool String::concat(unsigned int value)
+{
+    return concat(String(value));
+}
+
+bool String::concat(long value)
+{
+    return concat(String(value));
+}
+
+bool String::concat(unsigned long value)
+{
+    return concat(String(value));
+}
+
+bool String::concat(float value)
+{
+    return concat(String(value));
+}
+
+bool String::concat(double value)
+{
+    return concat(String(value));
+}
+
+bool String::equals(const String &s) const
+{
+    return len == s.len && strcmp(c_str(), s.c_str()) == 0;
+}
+
+bool String::equals(const char *cstr) const
+{
+    return strcmp(c_str(), cstr ? cstr : "") == 0;
+}
+
+bool String::startsWith(const String &prefix) const
+{
+    return prefix.len <= len && strncmp(c_str(), prefix.c_str(), prefix.len) == 0;
+}
+
+bool String::endsWith(const String &suffix) const
+{
+    return suffix.len <= len && strcmp(c_str() + len - suffix.len, suffix.c_str()) == 0;
+}
+
+char String::charAt(unsigned int index) const
+{
+    return index < len ? buffer[index] : '\0';
+}
+
+void String::toCharArray(char *buf, unsigned int bufsize, unsigned int index) const
+{
+    if (!buf || bufsize == 0)
+    {
+        return;
+    }
+    if (index >= len)
+    {
+        buf[0] = '\0';
+        return;
+    }
+    unsigned int n = len - index;
+    if (n > bufsize - 1)
+    {
+        n = bufsize - 1;
+    }
+    memcpy(buf, buffer + index, n);
+    buf[n] = '\0';
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const
+{
+    if (fromIndex >= len)
+    {
+        return -1;
+    }
+    const char *found = strchr(buffer + fromIndex, ch);
+    return found ? (int)(found - buffer) : -1;
+}
+
+int String::indexOf(const String &str, unsigned int fromIndex) const
+{
+    return indexOf(str.c_str(), fromIndex);
+}
+
+int String::indexOf(const char *str, unsigned int fromIndex) const
+{
+    if (fromIndex >= len)
+    {
+        return -1;
+    }
+    const char *found = strstr(buffer + fromIndex, str);
+    return found ? (int)(found - buffer) : -1;
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const
+{
+    if (beginIndex > endIndex)
+    {
+        unsigned int tmp = beginIndex;
+        beginIndex = endIndex;
+        endIndex = tmp;
+    }
+    if (beginIndex >= len)
+    {
+        return String();
+    }
+    if (endIndex > len)
+    {
+        endIndex = len;
+    }
+    return String(buffer + beginIndex, endIndex - beginIndex);
+}
+
+void String::trim()
+{
+    if (!buffer || len == 0)
+    {
+        return;
+    }
+    unsigned int begin = 0;
+    while (begin < len && isspace((unsigned char)buffer[begin]))
+    {
+        begin++;
+    }
+    unsigned int end = len;
+    while (end > begin && isspace((unsigned char)buffer[end - 1]))
+    {
+        end--;
+    }
+    len = end - begin;
+    memmove(buffer, buffer + begin, len);
+    buffer[len] = '\0';
+}
+
+long String::toInt() const
+{
+    return atol(c_str());
+}
+
+float String::toFloat() const
+{
+    return (float)atof(c_str());
+}
+
+String operator+(const String &lhs, const String &rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+String operator+(const String &lhs, const char *rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+String operator+(const char *lhs, const String &rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+String operator+(const String &lhs, char rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
@@ -0,0 +1,453 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  WiFiNINA.cpp
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Host implementation of the WiFiNINA stand-in over POSIX sockets
+ */
+
+#include "WiFiNINA.h"
+#include "utility/wifi_drv.h"
+#include "NativeHAL.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <ctime>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+WiFiClass WiFi;
+
+namespace
+{
+    // Sockets accepted by a WiFiServer and not stopped yet, as (listening socket, client socket)
+    std::vector<std::pair<int, int>> acceptedSockets;
+
+    // Like a real scan: the same SSID from two access points, a hidden network, not sorted
+    const char *simulatedNetworks[] = {"Neighbour-2.4G", nullptr, "Guest", "", "Neighbour-2.4G"};
+    const int32_t simulatedRssi[] = {-71, -48, -83, -60, -66};
+    const uint8_t simulatedEncryption[] = {ENC_TYPE_CCMP, ENC_TYPE_CCMP, ENC_TYPE_NONE, ENC_TYPE_CCMP, ENC_TYPE_CCMP};
+    const int simulatedNetworkCount = sizeof(simulatedRssi) / sizeof(simulatedRssi[0]);
+    // End of the scan started by WiFiDrv::startScanNetworks()
+    bool scanRunning = false;
+    unsigned long scanEnd = 0;
+
+    // The simulated access point is down while the file named by PLANTKEEPER_WIFI_DOWN exists
+    bool networkDown()
+    {
+        const char *path = nativeHal::env("PLANTKEEPER_WIFI_DOWN", nullptr);
+        return path && access(path, F_OK) == 0;
+    }
+
+    void forgetSocket(int sock)
+    {
+        for (size_t i = 0; i < acceptedSockets.size(); i++)
+        {
+            if (acceptedSockets[i].second == sock)
+            {
+                acceptedSockets.erase(acceptedSockets.begin() + i);
+                return;
+            }
+        }
+    }
+
+    void configureSocket(int sock)
+    {
+        int one = 1;
+        setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+}
+
+//--------------------------------------------WIFI RADIO--------------------------------------------
+
+int WiFiClass::begin(const char *ssid)
+{
+    return begin(ssid, "");
+}
+
+int WiFiClass::begin(const char *ssid, const char *passphrase)
+{
+    const char *expectedSsid = nativeHal::env("PLANTKEEPER_SSID", nullptr);
+    const char *expectedPass = nativeHal::env("PLANTKEEPER_PASS", nullptr);
+    unsigned long duration = (unsigned long)nativeHal::envLong("PLANTKEEPER_ASSOC_MS", 0);
+
+    if (!ssid || ssid[0] == '\0' || networkDown() || (expectedSsid && strcmp(ssid, expectedSsid) != 0))
+    {
+        associationOutcome = WL_NO_SSID_AVAIL;
+    }
+    else if (expectedPass && strcmp(passphrase, expectedPass) != 0)
+    {
+        associationOutcome = WL_CONNECT_FAILED;
+    }
+    else
+    {
+        associationOutcome = WL_CONNECTED;
+        if (!staticAddress)
+        {
+            duration += (unsigned long)nativeHal::envLong("PLANTKEEPER_DHCP_MS", 0);
+        }
+    }
+
+    // Like the NINA module, the outcome is only known once the association time has elapsed
+    currentStatus = WL_IDLE_STATUS;
+    associating = true;
+    associationEnd = millis() + duration;
+    if (beginTimeout > 0)
+    {
+        delay(duration < beginTimeout ? duration : beginTimeout);
+    }
+    return status();
+}
+
+uint8_t WiFiClass::beginAP(const char *ssid, const char *passphrase)
+{
+    (void)ssid;
+    (void)passphrase;
+    currentStatus = WL_AP_LISTENING;
+    return currentStatus;
+}
+
+void WiFiClass::end()
+{
+    currentStatus = WL_IDLE_STATUS;
+    associating = false;
+    staticAddress = false;
+}
+
+int WiFiClass::disconnect()
+{
+    currentStatus = WL_DISCONNECTED;
+    associating = false;
+    return currentStatus;
+}
+
+void WiFiClass::setTimeout(unsigned long timeout)
+{
+    beginTimeout = timeout;
+}
+
+void WiFiClass::config(IPAddress localIp, IPAddress dnsServer, IPAddress gateway, IPAddress subnet)
+{
+    (void)localIp;
+    (void)dnsServer;
+    (void)gateway;
+    (void)subnet;
+    staticAddress = true;
+}
+
+uint8_t WiFiClass::status()
+{
+    if (associating && (long)(millis() - associationEnd) >= 0)
+    {
+        associating = false;
+        currentStatus = associationOutcome;
+    }
+    if (currentStatus == WL_CONNECTED && networkDown())
+    {
+        currentStatus = WL_CONNECTION_LOST;
+    }
+    return currentStatus;
+}
+
+IPAddress WiFiClass::localIP()
+{
+    return IPAddress(127, 0, 0, 1);
+}
+
+IPAddress WiFiClass::gatewayIP()
+{
+    return IPAddress(127, 0, 0, 1);
+}
+
+IPAddress WiFiClass::subnetMask()
+{
+    return IPAddress(255, 0, 0, 0);
+}
+
+uint8_t *WiFiClass::macAddress(uint8_t *mac)
+{
+    // Locally administered and different for each process, like for each board; WiFiNINA gives the
+    // bytes last first
+    unsigned long pid = (unsigned long)getpid();
+    for (int i = 0; i < 4; i++)
+    {
+        mac[i] = (uint8_t)(pid >> (8 * i));
+    }
+    mac[4] = 0;
+    mac[5] = 0x02;
+    return mac;
+}
+
+int32_t WiFiClass::RSSI()
+{
+    return status() == WL_CONNECTED ? simulatedRssi[1] : 0;
+}
+
+int8_t WiFiClass::scanNetworks()
+{
+    WiFiDrv::startScanNetworks();
+    long remaining = (long)(scanEnd - millis());
+    if (remaining > 0)
+    {
+        delay((unsigned long)remaining);
+    }
+    return (int8_t)WiFiDrv::getScanNetworks();
+}
+
+const char *WiFiClass::SSID(uint8_t networkItem)
+{
+    return networkItem < simulatedNetworkCount ? simulatedNetworks[networkItem] : "";
+}
+
+int32_t WiFiClass::RSSI(uint8_t networkItem)
+{
+    return networkItem < simulatedNetworkCount ? simulatedRssi[networkItem] : 0;
+}
+
+uint8_t WiFiClass::encryptionType(uint8_t networkItem)
+{
+    return networkItem < simulatedNetworkCount ? simulatedEncryption[networkItem] : (uint8_t)ENC_TYPE_UNKNOWN;
+}
+
+unsigned long WiFiClass::getTime()
+{
+    return currentStatus == WL_CONNECTED ? (unsigned long)time(nullptr) : 0;
+}
+
+int8_t WiFiDrv::startScanNetworks()
+{
+    simulatedNetworks[1] = nativeHal::env("PLANTKEEPER_SSID", "PlantKeeperLab");
+    scanRunning = true;
+    scanEnd = millis() + (unsigned long)nativeHal::envLong("PLANTKEEPER_SCAN_MS", 2000);
+    return WL_SUCCESS;
+}
+
+uint8_t WiFiDrv::getScanNetworks()
+{
+    if (!scanRunning || (long)(millis() - scanEnd) < 0)
+    {
+        return 0;
+    }
+    return simulatedNetworkCount;
+}
+
+//--------------------------------------------WIFI CLIENT--------------------------------------------
+
+int WiFiClient::connect(IPAddress ip, uint16_t port)
+{
+    stop();
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        return 0;
+    }
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = ip.raw();
+    if (::connect(fd, (sockaddr *)&address, sizeof(address)) != 0)
+    {
+        close(fd);
+        return 0;
+    }
+    configureSocket(fd);
+    sock = fd;
+    return 1;
+}
+
+int WiFiClient::connect(const char *host, uint16_t port)
+{
+    addrinfo hints = {};
+    addrinfo *result = nullptr;
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(host, nullptr, &hints, &result) != 0 || !result)
+    {
+        return 0;
+    }
+    IPAddress ip(((sockaddr_in *)result->ai_addr)->sin_addr.s_addr);
+    freeaddrinfo(result);
+    return connect(ip, port);
+}
+
+size_t WiFiClient::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+size_t WiFiClient::write(const uint8_t *buf, size_t size)
+{
+    size_t sent = 0;
+    while (sock >= 0 && sent < size)
+    {
+        ssize_t n = send(sock, buf + sent, size - sent, MSG_NOSIGNAL);
+        if (n <= 0)
+        {
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        sent += (size_t)n;
+    }
+    return sent;
+}
+
+int WiFiClient::available()
+{
+    int count = 0;
+    if (sock < 0 || ioctl(sock, FIONREAD, &count) != 0)
+    {
+        return 0;
+    }
+    return count;
+}
+
+int WiFiClient::read()
+{
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t *buf, size_t size)
+{
+    if (sock < 0)
+    {
+        return -1;
+    }
+    ssize_t n = recv(sock, buf, size, MSG_DONTWAIT);
+    return n > 0 ? (int)n : -1;
+}
+
+int WiFiClient::peek()
+{
+    uint8_t c;
+    if (sock < 0 || recv(sock, &c, 1, MSG_PEEK | MSG_DONTWAIT) != 1)
+    {
+        return -1;
+    }
+    return c;
+}
+
+void WiFiClient::stop()
+{
+    if (sock >= 0)
+    {
+        forgetSocket(sock);
+        close(sock);
+        sock = -1;
+    }
+}
+
+uint8_t WiFiClient::connected()
+{
+    if (sock < 0)
+    {
+        return 0;
+    }
+    uint8_t c;
+    ssize_t n = recv(sock, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (n > 0)
+    {
+        return 1;
+    }
+    return (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) ? 1 : 0;
+}
+
+//--------------------------------------------WIFI SERVER--------------------------------------------
+
+void WiFiServer::begin()
+{
+    if (listenSocket >= 0)
+    {
+        return;
+    }
+    uint16_t bindPort = (uint16_t)nativeHal::envLong("PLANTKEEPER_HTTP_PORT", port);
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(bindPort);
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (sockaddr *)&address, sizeof(address)) != 0 || listen(fd, 16) != 0)
+    {
+        fprintf(stderr, "WiFiServer: cannot listen on port %u: %s\n", bindPort, strerror(errno));
+        close(fd);
+        return;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    listenSocket = fd;
+    fprintf(stderr, "WiFiServer: listening on port %u\n", bindPort);
+}
+
+WiFiClient WiFiServer::available()
+{
+    if (listenSocket < 0)
+    {
+        return WiFiClient();
+    }
+
+    int fd;
+    while ((fd = accept(listenSocket, nullptr, nullptr)) >= 0)
+    {
+        configureSocket(fd);
+        acceptedSockets.push_back(std::make_pair(listenSocket, fd));
+    }
+
+    // Like the NINA firmware, only hand out sockets that have data waiting
+    for (size_t i = 0; i < acceptedSockets.size(); i++)
+    {
+        if (acceptedSockets[i].first != listenSocket)
+        {
+            continue;
+        }
+        WiFiClient client(acceptedSockets[i].second);
+        if (client.available() > 0)
+        {
+            return client;
+        }
+        if (!client.connected())
+        {
+            // Peer went away without sending anything: nobody will ever stop() this socket
+            client.stop();
+            i--;
+        }
+    }
+    return WiFiClient();
+}
+
+size_t WiFiServer::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+size_t WiFiServer::write(const uint8_t *buf, size_t size)
+{
+    for (size_t i = 0; i < acceptedSockets.size(); i++)
+    {
+        if (acceptedSockets[i].first == listenSocket)
+        {
+            WiFiClient(acceptedSockets[i].second).write(buf, size);
+        }
+    }
+    return size;
+}
@@ -0,0 +1,132 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  WiFiNINA.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Host stand-in for the WiFiNINA library. The radio is simulated (association always succeeds
+ *        with the configured credentials) while WiFiServer and WiFiClient are real TCP sockets so the
+ *        device web server and the uplink can be exercised with ordinary HTTP tools.
+ */
+
+#ifndef NATIVE_WIFININA_H
+#define NATIVE_WIFININA_H
+
+#include "Arduino.h"
+
+typedef enum
+{
+    WL_NO_SHIELD = 255,
+    WL_NO_MODULE = WL_NO_SHIELD,
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL,
+    WL_SCAN_COMPLETED,
+    WL_CONNECTED,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED,
+    WL_AP_LISTENING,
+    WL_AP_CONNECTED,
+    WL_AP_FAILED
+} wl_status_t;
+
+#define WL_SUCCESS 1
+#define WL_FAILURE -1
+
+enum wl_enc_type
+{
+    ENC_TYPE_WEP = 5,
+    ENC_TYPE_TKIP = 2,
+    ENC_TYPE_CCMP = 4,
+    ENC_TYPE_NONE = 7,
+    ENC_TYPE_AUTO = 8,
+    ENC_TYPE_UNKNOWN = 255
+};
+
+class WiFiClass
+{
+public:
+    int begin(const char *ssid);
+    int begin(const char *ssid, const char *passphrase);
+    uint8_t beginAP(const char *ssid, const char *passphrase);
+    void end();
+    int disconnect();
+    uint8_t status();
+    void config(IPAddress localIp, IPAddress dnsServer, IPAddress gateway, IPAddress subnet);
+    void setTimeout(unsigned long timeout);
+
+    IPAddress localIP();
+    IPAddress gatewayIP();
+    IPAddress subnetMask();
+    uint8_t *macAddress(uint8_t *mac);
+    int32_t RSSI();
+    int8_t scanNetworks();
+    const char *SSID(uint8_t networkItem);
+    int32_t RSSI(uint8_t networkItem);
+    uint8_t encryptionType(uint8_t networkItem);
+    unsigned long getTime();
+
+private:
+    uint8_t currentStatus = WL_IDLE_STATUS;
+    // Set by config() until end(), the module forgets it when powered down
+    bool staticAddress = false;
+    // How long begin() waits for the association, 0 returns at once and status() tells the outcome
+    unsigned long beginTimeout = 10000;
+    bool associating = false;
+    uint8_t associationOutcome = WL_IDLE_STATUS;
+    unsigned long associationEnd = 0;
+};
+
+extern WiFiClass WiFi;
+
+class WiFiClient : public Client
+{
+public:
+    WiFiClient() {}
+    explicit WiFiClient(int socket) : sock(socket) {}
+
+    int connect(IPAddress ip, uint16_t port) override;
+    int connect(const char *host, uint16_t port) override;
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buf, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int read(uint8_t *buf, size_t size) override;
+    int peek() override;
+    void flush() override {}
+    void stop() override;
+    uint8_t connected() override;
+    operator bool() override { return sock >= 0; }
+    bool operator==(const WiFiClient &other) const { return sock == other.sock; }
+    bool operator!=(const WiFiClient &other) const { return sock != other.sock; }
+
+private:
+    int sock = -1;
+};
+
+class WiFiServer : public Server
+{
+public:
+    explicit WiFiServer(uint16_t port) : port(port) {}
+
+    void begin() override;
+    WiFiClient available();
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buf, size_t size) override;
+    using Print::write;
+
+private:
+    uint16_t port;
+    int listenSocket = -1;
+};
+
+#endif
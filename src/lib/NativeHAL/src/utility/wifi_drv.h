@@ -0,0 +1,32 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  wifi_drv.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Host stand-in for the part of the WiFiNINA driver used to scan without blocking
+ */
+
+#ifndef NATIVE_WIFI_DRV_H
+#define NATIVE_WIFI_DRV_H
+
+#include "../WiFiNINA.h"
+
+class WiFiDrv
+{
+public:
+    // WL_FAILURE if the module cannot scan, the results are then read with getScanNetworks()
+    static int8_t startScanNetworks();
+    // Number of networks found, 0 while the scan is running
+    static uint8_t getScanNetworks();
+};
+
+#endif
@@ -0,0 +1,125 @@
+"""
+Project Name: PlantKeeper
+
+@created 18.10.2026
+@file  webAssets.py
+@version 1.0.0
+@see https://github.com/Plant-keeper
+
+@authors
+  - Rafael Dousse
+  - Eva Ray
+  - Quentin Surdez
+  - Rachel Tranchida
+
+@brief Compresses the static files of the web interface (web/) into src/webAssets.h, as constant
+       arrays the firmware serves from flash. Run by PlatformIO before every build (extra_scripts),
+       or by hand with `python3 scripts/webAssets.py` from the project directory. The header is only
+       rewritten when its content changes, so it does not trigger a rebuild for nothing.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+CONTENT_TYPES = {
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".html": "text/html",
+}
+
+
+def project_dir():
+    try:
+        Import("env")  # noqa: F821, provided by PlatformIO
+        return env.subst("$PROJECT_DIR")  # noqa: F821
+    except NameError:
+        return os.getcwd()
+
+
+def c_name(file_name):
+    parts = re.split(r"[^A-Za-z0-9]", file_name)
+    return parts[0] + "".join(part.capitalize() for part in parts[1:])
+
+
+def c_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def generate(root):
+    web_dir = os.path.join(root, "web")
+    arrays = []
+    entries = []
+    for file_name in sorted(os.listdir(web_dir)):
+        extension = os.path.splitext(file_name)[1]
+        if extension not in CONTENT_TYPES:
+            continue
+        with open(os.path.join(web_dir, file_name), "rb") as f:
+            plain = f.read()
+        # No timestamp in the gzip header, the output only depends on the file
+        compressed = gzip.compress(plain, 9, mtime=0)
+        name = c_name(file_name)
+        arrays.append("static const uint8_t %sPlain[] PROGMEM = {\n%s\n};\n" % (name, c_bytes(plain)))
+        arrays.append("static const uint8_t %sGzip[] PROGMEM = {\n%s\n};\n" % (name, c_bytes(compressed)))
+        entries.append('    {"/%s", "%s", "%s", %sPlain, sizeof(%sPlain), %sGzip, sizeof(%sGzip)},'
+                       % (file_name, CONTENT_TYPES[extension], hashlib.sha1(plain).hexdigest()[:12],
+                          name, name, name, name))
+
+    return """/**
+ * Project Name: PlantKeeper
+ *
+ * @file  webAssets.h
+ * @see https://github.com/Plant-keeper
+ *
+ * @brief Static files of the web interface, generated from web/ by scripts/webAssets.py. Do not edit.
+ *
+ */
+
+#ifndef WEBASSETS_H
+#define WEBASSETS_H
+
+#include <Arduino.h>
+
+/**
+ * @brief A file served as it is, with its gzip encoding for the clients that accept it
+ */
+struct WebAsset
+{
+    const char *path;
+    const char *contentType;
+    const char *etag; // Hash of the content, without the quotes and the suffix of the gzip encoding
+    const uint8_t *plain;
+    size_t plainSize;
+    const uint8_t *gzip;
+    size_t gzipSize;
+};
+
+%s
+static const WebAsset webAssets[] = {
+%s
+};
+
+#endif
+""" % ("\n".join(arrays), "\n".join(entries))
+
+
+def main():
+    root = project_dir()
+    header = os.path.join(root, "src", "webAssets.h")
+    content = generate(root)
+    try:
+        with open(header) as f:
+            if f.read() == content:
+                return
+    except FileNotFoundError:
+        pass
+    with open(header, "w") as f:
+        f.write(content)
+    print("Generated %s" % header)
+
+
+main()
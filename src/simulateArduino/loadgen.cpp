@@ -0,0 +1,1223 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  loadgen.cpp
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ *
+ * @brief Load and soak harness for the /sensor-data backend, a Linux program independent of the
+ *        firmware build:
+ *
+ *          g++ -std=c++17 -O2 -pthread -o loadgen loadgen.cpp
+ *
+ *          loadgen send    --server 127.0.0.1:8080 --devices 2000 --interval 10000 --batch 10
+ *          loadgen receive --port 8080
+ *          loadgen soak    --devices 2000 --interval 1000 --duration 60
+ *
+ *        send simulates devices that upload like the firmware: a sample every --interval ms, posted
+ *        to /sensor-data when --batch samples are waiting, as the JSON of writeSampleJson() or the
+ *        binary layout of telemetry.h (--binary). A device keeps its connection open, buffers up to
+ *        --buffer samples while the server fails (the oldest are dropped beyond that) and sends its
+ *        backlog as soon as an upload succeeds again.
+ *
+ *        receive is a stand-in for the server: it answers every upload, can be slowed down or made
+ *        to fail, and counts the samples. It also counts the duplicates and the gaps in the sequence
+ *        numbers of each sensor and boot, which are the samples lost on the way. The numbers of a
+ *        boot do not start at 1, so the gaps are counted from the first sample received.
+ *
+ *        soak runs both in one process over the loopback. Every mode prints one line per second and
+ *        a summary with the throughput, the latency percentiles and the drop counts.
+ */
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <queue>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    //--------------------------------------------COMMON--------------------------------------------
+
+    struct Options
+    {
+        std::string host = "127.0.0.1";
+        uint16_t port = 8080;
+        int devices = 100;
+        int firstId = 1;
+        long intervalMs = 10000;
+        int batch = 1;
+        int buffer = 64;
+        long durationS = 60;
+        long timeoutMs = 5000;
+        bool binary = false;
+        bool keepAlive = true;
+        // Receiver only
+        long delayMs = 0;
+        int failPercent = 0;
+    };
+
+    std::atomic<bool> stopRequested(false);
+
+    uint64_t nowUs()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    void setNonBlocking(int fd)
+    {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    }
+
+    // Thousands of devices with a connection each exceed the usual limit of 1024 descriptors
+    void raiseDescriptorLimit()
+    {
+        rlimit limit;
+        if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max)
+        {
+            limit.rlim_cur = limit.rlim_max;
+            setrlimit(RLIMIT_NOFILE, &limit);
+        }
+    }
+
+    uint64_t mix(uint64_t x)
+    {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * @brief Percentiles over the latencies of a period, in microseconds
+     */
+    struct Latencies
+    {
+        std::vector<uint32_t> values;
+
+        void add(uint64_t us)
+        {
+            values.push_back((uint32_t)std::min<uint64_t>(us, UINT32_MAX));
+        }
+
+        double percentileMs(double p)
+        {
+            if (values.empty())
+            {
+                return 0;
+            }
+            size_t index = std::min(values.size() - 1, (size_t)(p / 100.0 * values.size()));
+            std::nth_element(values.begin(), values.begin() + index, values.end());
+            return values[index] / 1000.0;
+        }
+
+        double maxMs() const
+        {
+            return values.empty() ? 0 : *std::max_element(values.begin(), values.end()) / 1000.0;
+        }
+    };
+
+    /**
+     * @brief Extracts the status code and the body length of a response or the body length of a
+     *        request once its header is complete
+     * @return Length of the header including the blank line, 0 while incomplete
+     */
+    size_t parseHeader(const std::string &data, int &statusCode, long &contentLength, bool &close)
+    {
+        size_t end = data.find("\r\n\r\n");
+        if (end == std::string::npos)
+        {
+            return 0;
+        }
+        statusCode = 0;
+        contentLength = -1;
+        close = false;
+        if (data.compare(0, 5, "HTTP/") == 0)
+        {
+            size_t space = data.find(' ');
+            statusCode = space < end ? atoi(data.c_str() + space + 1) : 0;
+            close = data.compare(0, 8, "HTTP/1.0") == 0;
+        }
+
+        size_t line = data.find("\r\n") + 2;
+        while (line < end)
+        {
+            size_t next = data.find("\r\n", line);
+            std::string header = data.substr(line, next - line);
+            for (char &c : header)
+            {
+                c = (char)tolower((unsigned char)c);
+            }
+            if (header.compare(0, 15, "content-length:") == 0)
+            {
+                contentLength = atol(header.c_str() + 15);
+            }
+            else if (header.compare(0, 11, "connection:") == 0)
+            {
+                close = header.find("close") != std::string::npos;
+            }
+            line = next + 2;
+        }
+        return end + 4;
+    }
+
+    //--------------------------------------------RECEIVER--------------------------------------------
+
+    struct ReceiverCounters
+    {
+        uint64_t requests = 0;
+        uint64_t samples = 0;
+        uint64_t bytes = 0;
+        uint64_t rejected = 0;  // Answered with an error on purpose (--fail-percent)
+        uint64_t invalid = 0;   // Bodies that do not follow the format
+        uint64_t duplicates = 0;
+        uint64_t gaps = 0;
+    };
+
+    class Receiver
+    {
+    public:
+        explicit Receiver(const Options &options) : options(options), listenFd(-1), epollFd(-1), seed(1) {}
+
+        /**
+         * @brief Binds the listening socket
+         * @return The port, 0 on failure
+         */
+        uint16_t bind(uint16_t port)
+        {
+            listenFd = socket(AF_INET, SOCK_STREAM, 0);
+            int one = 1;
+            setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(port);
+            address.sin_addr.s_addr = htonl(INADDR_ANY);
+            if (::bind(listenFd, (sockaddr *)&address, sizeof(address)) != 0 || listen(listenFd, 4096) != 0)
+            {
+                perror("receiver");
+                return 0;
+            }
+            setNonBlocking(listenFd);
+            socklen_t length = sizeof(address);
+            getsockname(listenFd, (sockaddr *)&address, &length);
+
+            epollFd = epoll_create1(0);
+            epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.fd = listenFd;
+            epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+            return ntohs(address.sin_port);
+        }
+
+        void run()
+        {
+            std::vector<epoll_event> events(1024);
+            while (!stopRequested)
+            {
+                int timeout = delayed.empty() ? 100 : 1;
+                int n = epoll_wait(epollFd, events.data(), (int)events.size(), timeout);
+                for (int i = 0; i < n; i++)
+                {
+                    if (events[i].data.fd == listenFd)
+                    {
+                        acceptAll();
+                    }
+                    else
+                    {
+                        readFrom(events[i].data.fd);
+                    }
+                }
+                sendDelayed();
+            }
+        }
+
+        const ReceiverCounters &getCounters() const
+        {
+            return counters;
+        }
+
+    private:
+        struct Connection
+        {
+            std::string in;
+        };
+
+        struct DelayedResponse
+        {
+            uint64_t due;
+            int fd;
+            bool fail;
+            bool close;
+            bool operator>(const DelayedResponse &other) const
+            {
+                return due > other.due;
+            }
+        };
+
+        void acceptAll()
+        {
+            int fd;
+            while ((fd = accept(listenFd, nullptr, nullptr)) >= 0)
+            {
+                setNonBlocking(fd);
+                int one = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                epoll_event event = {};
+                event.events = EPOLLIN;
+                event.data.fd = fd;
+                epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+                connections[fd] = Connection();
+            }
+        }
+
+        void closeConnection(int fd)
+        {
+            epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+            close(fd);
+            connections.erase(fd);
+        }
+
+        void readFrom(int fd)
+        {
+            auto found = connections.find(fd);
+            if (found == connections.end())
+            {
+                return;
+            }
+            std::string &in = found->second.in;
+            char chunk[4096];
+            for (;;)
+            {
+                ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+                if (n > 0)
+                {
+                    in.append(chunk, (size_t)n);
+                    continue;
+                }
+                if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+                {
+                    closeConnection(fd);
+                    return;
+                }
+                break;
+            }
+
+            // Pipelined requests are answered in order
+            for (;;)
+            {
+                int statusCode;
+                long length;
+                bool closeAfter;
+                size_t header = parseHeader(in, statusCode, length, closeAfter);
+                if (header == 0 || in.size() < header + (size_t)std::max(length, 0L))
+                {
+                    return;
+                }
+                std::string body = in.substr(header, (size_t)std::max(length, 0L));
+                bool post = in.compare(0, 17, "POST /sensor-data") == 0;
+                in.erase(0, header + body.size());
+
+                bool fail = !post || (options.failPercent > 0 && (int)(mix(seed++) % 100) < options.failPercent);
+                if (post)
+                {
+                    counters.requests++;
+                    counters.bytes += body.size();
+                    if (fail)
+                    {
+                        counters.rejected++;
+                    }
+                    else
+                    {
+                        count(body);
+                    }
+                }
+                DelayedResponse response = {nowUs() + (uint64_t)options.delayMs * 1000, fd, fail, closeAfter};
+                if (options.delayMs > 0)
+                {
+                    delayed.push(response);
+                }
+                else
+                {
+                    respond(response);
+                }
+                if (closeAfter)
+                {
+                    return;
+                }
+            }
+        }
+
+        void respond(const DelayedResponse &response)
+        {
+            if (connections.find(response.fd) == connections.end())
+            {
+                return;
+            }
+            static const char ok[] = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: 11\r\n\r\n{\"ok\":true}";
+            static const char failed[] = "HTTP/1.1 500 Internal Server Error\r\nContent-Length: 0\r\n\r\n";
+            const char *text = response.fail ? failed : ok;
+            send(response.fd, text, strlen(text), MSG_NOSIGNAL);
+            if (response.close)
+            {
+                closeConnection(response.fd);
+            }
+        }
+
+        void sendDelayed()
+        {
+            uint64_t now = nowUs();
+            while (!delayed.empty() && delayed.top().due <= now)
+            {
+                respond(delayed.top());
+                delayed.pop();
+            }
+        }
+
+        /**
+         * @brief Value of a JSON member of the sample starting at an offset, the body is trusted
+         */
+        static bool jsonNumber(const std::string &body, size_t sample, const char *key, unsigned long &value)
+        {
+            size_t end = body.find('}', sample);
+            size_t at = body.find(key, sample);
+            if (at == std::string::npos || at > end)
+            {
+                return false;
+            }
+            value = strtoul(body.c_str() + at + strlen(key), nullptr, 10);
+            return true;
+        }
+
+        void countSequence(uint16_t sensorId, uint16_t boot, uint32_t sequence)
+        {
+            // A board numbers its samples on from the previous boots, the first one seen is the baseline
+            auto found = lastSequence.emplace((uint32_t)sensorId << 16 | boot, sequence);
+            if (found.second)
+            {
+                return;
+            }
+            uint32_t &last = found.first->second;
+            if (sequence <= last)
+            {
+                counters.duplicates++;
+            }
+            else
+            {
+                counters.gaps += sequence - last - 1;
+                last = sequence;
+            }
+        }
+
+        void count(const std::string &body)
+        {
+            if (!body.empty() && (body[0] == '{' || body[0] == '['))
+            {
+                // One "id" per sample, in the object or in each element of the array
+                size_t samples = 0;
+                for (size_t at = body.find("\"id\""); at != std::string::npos; at = body.find("\"id\"", at + 4))
+                {
+                    samples++;
+                    unsigned long id, boot, sequence;
+                    if (jsonNumber(body, at, "\"id\":", id) && jsonNumber(body, at, "\"boot\":", boot) &&
+                        jsonNumber(body, at, "\"sequence\":", sequence))
+                    {
+                        countSequence((uint16_t)id, (uint16_t)boot, (uint32_t)sequence);
+                    }
+                }
+                if (samples == 0)
+                {
+                    counters.invalid++;
+                }
+                counters.samples += samples;
+                return;
+            }
+
+            const uint8_t *bytes = (const uint8_t *)body.data();
+            size_t records = body.size() >= 6 ? bytes[1] : 0;
+            size_t recordSize = body.size() >= 6 ? 12 + 6 * (size_t)bytes[5] : 0;
+            if (body.size() < 6 || bytes[0] != 3 || records == 0 || body.size() != 6 + records * recordSize)
+            {
+                counters.invalid++;
+                return;
+            }
+            uint16_t sensorId = (uint16_t)(bytes[2] | bytes[3] << 8);
+            for (size_t i = 0; i < records; i++)
+            {
+                const uint8_t *record = bytes + 6 + i * recordSize;
+                uint32_t sequence = record[0] | record[1] << 8 | record[2] << 16 | (uint32_t)record[3] << 24;
+                uint16_t boot = (uint16_t)(record[8] | record[9] << 8);
+                countSequence(sensorId, boot, sequence);
+            }
+            counters.samples += records;
+        }
+
+        const Options &options;
+        int listenFd;
+        int epollFd;
+        uint64_t seed;
+        std::unordered_map<int, Connection> connections;
+        std::priority_queue<DelayedResponse, std::vector<DelayedResponse>, std::greater<DelayedResponse>> delayed;
+        // Highest sequence number received per (sensor id, boot)
+        std::unordered_map<uint32_t, uint32_t> lastSequence;
+        ReceiverCounters counters;
+    };
+
+    //--------------------------------------------DEVICES--------------------------------------------
+
+    struct SenderCounters
+    {
+        uint64_t requests = 0;
+        uint64_t accepted = 0;        // 2xx responses
+        uint64_t httpErrors = 0;      // Other status codes
+        uint64_t connectErrors = 0;
+        uint64_t timeouts = 0;
+        uint64_t brokenConnections = 0;
+        uint64_t newConnections = 0;
+        uint64_t reusedConnections = 0;
+        uint64_t samplesTaken = 0;
+        uint64_t samplesAccepted = 0;
+        uint64_t samplesDropped = 0;  // Overwritten in the buffer of a device
+    };
+
+    /**
+     * @brief A simulated board. Samples are not stored: they are derived from the sensor id and the
+     *        sequence number, so a retried upload sends the same values.
+     */
+    struct Device
+    {
+        enum State
+        {
+            IDLE,
+            CONNECTING,
+            SENDING,
+            RECEIVING
+        };
+
+        uint16_t id;
+        uint32_t nextSequence = 1;     // Of the next sample taken
+        uint32_t oldestPending = 1;    // Sequence of the oldest sample not uploaded yet
+        uint64_t firstSampleUs = 0;
+        int fd = -1;
+        State state = IDLE;
+        bool reused = false;
+        bool retried = false;
+        uint32_t inFlight = 0;
+        uint64_t requestStart = 0;
+        uint64_t deadline = 0;
+        std::string out;
+        size_t outPos = 0;
+        std::string in;
+
+        uint32_t pending() const
+        {
+            return nextSequence - oldestPending;
+        }
+    };
+
+    class Fleet
+    {
+    public:
+        explicit Fleet(const Options &options) : options(options), epollFd(epoll_create1(0))
+        {
+            devices.resize(options.devices);
+            uint64_t start = nowUs();
+            for (int i = 0; i < options.devices; i++)
+            {
+                Device &device = devices[i];
+                device.id = (uint16_t)(options.firstId + i);
+                // Spread the devices over the interval instead of starting them all at once
+                device.firstSampleUs = start + (uint64_t)(mix(i) % (uint64_t)(options.intervalMs * 1000));
+                timers.push(Timer{device.firstSampleUs, (size_t)i});
+            }
+        }
+
+        bool resolve()
+        {
+            addrinfo hints = {};
+            addrinfo *result = nullptr;
+            hints.ai_family = AF_INET;
+            hints.ai_socktype = SOCK_STREAM;
+            if (getaddrinfo(options.host.c_str(), nullptr, &hints, &result) != 0 || !result)
+            {
+                fprintf(stderr, "cannot resolve %s\n", options.host.c_str());
+                return false;
+            }
+            server = *(sockaddr_in *)result->ai_addr;
+            server.sin_port = htons(options.port);
+            freeaddrinfo(result);
+            return true;
+        }
+
+        /**
+         * @brief Runs the devices until stopRequested or the end time
+         */
+        void run(uint64_t endUs)
+        {
+            std::vector<epoll_event> events(1024);
+            uint64_t nextSweep = nowUs();
+            while (!stopRequested && nowUs() < endUs)
+            {
+                uint64_t now = nowUs();
+                int timeout = 100;
+                if (!timers.empty())
+                {
+                    timeout = timers.top().due <= now ? 0 : (int)std::min<uint64_t>(100, (timers.top().due - now) / 1000 + 1);
+                }
+                int n = epoll_wait(epollFd, events.data(), (int)events.size(), timeout);
+                for (int i = 0; i < n; i++)
+                {
+                    onSocket(devices[events[i].data.u64], events[i].events);
+                }
+
+                now = nowUs();
+                while (!timers.empty() && timers.top().due <= now)
+                {
+                    size_t index = timers.top().device;
+                    timers.pop();
+                    takeSample(devices[index], now);
+                }
+                if (now >= nextSweep)
+                {
+                    nextSweep = now + 50000;
+                    for (Device &device : devices)
+                    {
+                        if (device.state != Device::IDLE && now >= device.deadline)
+                        {
+                            counters.timeouts++;
+                            fail(device);
+                        }
+                    }
+                }
+            }
+        }
+
+        const SenderCounters &getCounters() const
+        {
+            return counters;
+        }
+
+        uint64_t pendingSamples() const
+        {
+            uint64_t total = 0;
+            for (const Device &device : devices)
+            {
+                total += device.pending();
+            }
+            return total;
+        }
+
+        // Latencies of the successful uploads, since the start and since the last report
+        Latencies all;
+        Latencies recent;
+
+    private:
+        struct Timer
+        {
+            uint64_t due;
+            size_t device;
+            bool operator>(const Timer &other) const
+            {
+                return due > other.due;
+            }
+        };
+
+        void takeSample(Device &device, uint64_t now)
+        {
+            device.nextSequence++;
+            counters.samplesTaken++;
+            if (device.pending() > (uint32_t)options.buffer)
+            {
+                device.oldestPending++;
+                counters.samplesDropped++;
+            }
+            timers.push(Timer{now + (uint64_t)options.intervalMs * 1000, (size_t)(&device - devices.data())});
+            // Like the firmware, a failed upload is retried with the next sample
+            if (device.state == Device::IDLE && device.pending() >= (uint32_t)options.batch)
+            {
+                startUpload(device, now);
+            }
+        }
+
+        void startUpload(Device &device, uint64_t now)
+        {
+            device.inFlight = std::min<uint32_t>(device.pending(), (uint32_t)options.batch);
+            device.out.clear();
+            device.outPos = 0;
+            device.in.clear();
+            buildRequest(device, now);
+            device.requestStart = now;
+            device.deadline = now + (uint64_t)options.timeoutMs * 1000;
+            device.retried = false;
+            counters.requests++;
+            send(device);
+        }
+
+        void send(Device &device)
+        {
+            device.reused = device.fd >= 0;
+            if (device.reused)
+            {
+                counters.reusedConnections++;
+                device.state = Device::SENDING;
+                watch(device, EPOLL_CTL_MOD, true);
+                writeRequest(device);
+                return;
+            }
+
+            counters.newConnections++;
+            device.fd = socket(AF_INET, SOCK_STREAM, 0);
+            setNonBlocking(device.fd);
+            int one = 1;
+            setsockopt(device.fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            watch(device, EPOLL_CTL_ADD, true);
+            if (connect(device.fd, (sockaddr *)&server, sizeof(server)) != 0 && errno != EINPROGRESS)
+            {
+                counters.connectErrors++;
+                fail(device);
+                return;
+            }
+            device.state = Device::CONNECTING;
+        }
+
+        void onSocket(Device &device, uint32_t events)
+        {
+            if (device.state == Device::CONNECTING)
+            {
+                int error = 0;
+                socklen_t length = sizeof(error);
+                getsockopt(device.fd, SOL_SOCKET, SO_ERROR, &error, &length);
+                if (error != 0 || (events & (EPOLLERR | EPOLLHUP)))
+                {
+                    counters.connectErrors++;
+                    fail(device);
+                    return;
+                }
+                device.state = Device::SENDING;
+            }
+            if (device.state == Device::SENDING && (events & EPOLLOUT))
+            {
+                writeRequest(device);
+            }
+            if (device.state == Device::RECEIVING || (events & (EPOLLIN | EPOLLHUP | EPOLLERR)))
+            {
+                readResponse(device);
+            }
+        }
+
+        void writeRequest(Device &device)
+        {
+            while (device.outPos < device.out.size())
+            {
+                ssize_t n = ::send(device.fd, device.out.data() + device.outPos, device.out.size() - device.outPos, MSG_NOSIGNAL);
+                if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                {
+                    return;
+                }
+                if (n <= 0)
+                {
+                    broken(device);
+                    return;
+                }
+                device.outPos += (size_t)n;
+            }
+            device.state = Device::RECEIVING;
+            watch(device, EPOLL_CTL_MOD, false);
+        }
+
+        // Writability is only watched while a request is being sent, epoll is level-triggered
+        void watch(Device &device, int operation, bool writable)
+        {
+            epoll_event event = {};
+            event.events = writable ? EPOLLIN | EPOLLOUT : EPOLLIN;
+            event.data.u64 = (uint64_t)(&device - devices.data());
+            epoll_ctl(epollFd, operation, device.fd, &event);
+        }
+
+        void readResponse(Device &device)
+        {
+            char chunk[2048];
+            bool closed = false;
+            for (;;)
+            {
+                ssize_t n = recv(device.fd, chunk, sizeof(chunk), 0);
+                if (n > 0)
+                {
+                    device.in.append(chunk, (size_t)n);
+                    continue;
+                }
+                closed = n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK);
+                break;
+            }
+            if (device.state != Device::RECEIVING)
+            {
+                if (closed)
+                {
+                    // The server closed an idle keep-alive connection
+                    closeSocket(device);
+                }
+                return;
+            }
+
+            int statusCode;
+            long length;
+            bool closeAfter;
+            size_t header = parseHeader(device.in, statusCode, length, closeAfter);
+            bool complete = header > 0 && (length < 0 ? closed : device.in.size() >= header + (size_t)length);
+            if (!complete)
+            {
+                if (closed)
+                {
+                    broken(device);
+                }
+                return;
+            }
+
+            if (closeAfter || closed || !options.keepAlive)
+            {
+                closeSocket(device);
+            }
+            device.state = Device::IDLE;
+            if (statusCode < 200 || statusCode >= 300)
+            {
+                counters.httpErrors++;
+                return;
+            }
+
+            uint64_t now = nowUs();
+            all.add(now - device.requestStart);
+            recent.add(now - device.requestStart);
+            counters.accepted++;
+            counters.samplesAccepted += device.inFlight;
+            device.oldestPending += device.inFlight;
+            // Send the backlog right away
+            if (device.pending() >= (uint32_t)options.batch)
+            {
+                startUpload(device, now);
+            }
+        }
+
+        // A reused connection may have been closed by the server meanwhile: retry once on a new one
+        void broken(Device &device)
+        {
+            bool retry = device.reused && !device.retried && device.in.empty();
+            closeSocket(device);
+            if (retry)
+            {
+                device.retried = true;
+                device.outPos = 0;
+                send(device);
+                return;
+            }
+            counters.brokenConnections++;
+            device.state = Device::IDLE;
+        }
+
+        void fail(Device &device)
+        {
+            closeSocket(device);
+            device.state = Device::IDLE;
+        }
+
+        void closeSocket(Device &device)
+        {
+            if (device.fd >= 0)
+            {
+                epoll_ctl(epollFd, EPOLL_CTL_DEL, device.fd, nullptr);
+                close(device.fd);
+                device.fd = -1;
+            }
+        }
+
+        //------------------------------------------BODIES------------------------------------------
+
+        struct Aggregate
+        {
+            int mean;
+            int min;
+            int max;
+        };
+
+        // Deterministic values of one sample, close to what the sensors of a plant return
+        static Aggregate quantity(uint16_t id, uint32_t sequence, int kind, int low, int high)
+        {
+            uint64_t random = mix((uint64_t)id << 40 | (uint64_t)kind << 32 | sequence);
+            int range = high - low;
+            int mean = low + (int)(random % (uint64_t)(range + 1));
+            int spread = (int)((random >> 32) % (uint64_t)(range / 20 + 1));
+            return Aggregate{mean, std::max(low, mean - spread), std::min(high, mean + spread)};
+        }
+
+        void buildRequest(Device &device, uint64_t now)
+        {
+            std::string body;
+            if (options.binary)
+            {
+                buildBinary(device, now, body);
+            }
+            else
+            {
+                buildJson(device, now, body);
+            }
+
+            char header[256];
+            snprintf(header, sizeof(header),
+                     "POST /sensor-data HTTP/1.1\r\nHost: %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\n"
+                     "Accept: */*\r\n%s\r\n",
+                     options.host.c_str(),
+                     options.binary ? "application/vnd.plantkeeper.samples.v3" : "application/json", body.size(),
+                     options.keepAlive ? "" : "Connection: close\r\n");
+            device.out = header;
+            device.out += body;
+        }
+
+        uint64_t takenAt(const Device &device, uint32_t sequence) const
+        {
+            return device.firstSampleUs + (uint64_t)(sequence - 1) * (uint64_t)options.intervalMs * 1000;
+        }
+
+        // Same fields as writeSampleJson() of the firmware
+        void buildJson(const Device &device, uint64_t now, std::string &body)
+        {
+            bool array = options.batch > 1;
+            char item[320];
+            if (array)
+            {
+                body += '[';
+            }
+            for (uint32_t i = 0; i < device.inFlight; i++)
+            {
+                uint32_t sequence = device.oldestPending + i;
+                Aggregate temperature = quantity(device.id, sequence, 0, 1500, 3500);
+                Aggregate humidity = quantity(device.id, sequence, 1, 20, 80);
+                Aggregate light = quantity(device.id, sequence, 2, 0, 2000);
+                int length = snprintf(item, sizeof(item),
+                                      "%s{\"id\":%u,\"temperature\":%.2f,\"temperatureMin\":%.2f,\"temperatureMax\":%.2f,"
+                                      "\"humidity\":%d,\"humidityMin\":%d,\"humidityMax\":%d,"
+                                      "\"light\":%d,\"lightMin\":%d,\"lightMax\":%d,\"readings\":5,"
+                                      "\"sequence\":%u,\"boot\":1",
+                                      i ? "," : "", (unsigned)device.id, temperature.mean / 100.0, temperature.min / 100.0,
+                                      temperature.max / 100.0, humidity.mean, humidity.min, humidity.max, light.mean,
+                                      light.min, light.max, (unsigned)sequence);
+                body.append(item, (size_t)length);
+                if (array)
+                {
+                    length = snprintf(item, sizeof(item), ",\"age\":%llu",
+                                      (unsigned long long)((now - takenAt(device, sequence)) / 1000));
+                    body.append(item, (size_t)length);
+                }
+                body += '}';
+            }
+            if (array)
+            {
+                body += ']';
+            }
+        }
+
+        // Layout of telemetry.h for the standard sensor kit
+        void buildBinary(const Device &device, uint64_t now, std::string &body)
+        {
+            (void)now;
+            body.reserve(6 + device.inFlight * 36);
+            put8(body, 3);
+            put8(body, (uint8_t)device.inFlight);
+            put16(body, device.id);
+            put8(body, 0);
+            put8(body, 4);
+            for (uint32_t i = 0; i < device.inFlight; i++)
+            {
+                uint32_t sequence = device.oldestPending + i;
+                put32(body, sequence);
+                put32(body, 0);
+                put16(body, 1);
+                put16(body, 5);
+                putAggregate(body, quantity(device.id, sequence, 0, 1500, 3500));
+                putAggregate(body, quantity(device.id, sequence, 1, 20, 80));
+                putAggregate(body, quantity(device.id, sequence, 3, 700, 1023));
+                putAggregate(body, quantity(device.id, sequence, 2, 0, 2000));
+            }
+        }
+
+        static void put8(std::string &body, uint8_t value)
+        {
+            body += (char)value;
+        }
+
+        static void put16(std::string &body, uint16_t value)
+        {
+            put8(body, (uint8_t)value);
+            put8(body, (uint8_t)(value >> 8));
+        }
+
+        static void put32(std::string &body, uint32_t value)
+        {
+            put16(body, (uint16_t)value);
+            put16(body, (uint16_t)(value >> 16));
+        }
+
+        static void putAggregate(std::string &body, const Aggregate &aggregate)
+        {
+            put16(body, (uint16_t)aggregate.mean);
+            put16(body, (uint16_t)aggregate.min);
+            put16(body, (uint16_t)aggregate.max);
+        }
+
+        const Options &options;
+        int epollFd;
+        sockaddr_in server = {};
+        std::vector<Device> devices;
+        std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers;
+        SenderCounters counters;
+    };
+
+    //--------------------------------------------REPORTS--------------------------------------------
+
+    void reportSender(Fleet &fleet, double seconds, SenderCounters &previous)
+    {
+        const SenderCounters &c = fleet.getCounters();
+        printf("[%5.0f s] send: %6.0f req/s %7.0f samples/s, latency p50 %.1f p99 %.1f ms, errors %llu, dropped %llu, pending %llu\n",
+               seconds, (double)(c.accepted - previous.accepted), (double)(c.samplesAccepted - previous.samplesAccepted),
+               fleet.recent.percentileMs(50), fleet.recent.percentileMs(99),
+               (unsigned long long)(c.httpErrors + c.connectErrors + c.timeouts + c.brokenConnections),
+               (unsigned long long)c.samplesDropped, (unsigned long long)fleet.pendingSamples());
+        fflush(stdout);
+        fleet.recent.values.clear();
+        previous = c;
+    }
+
+    void summarizeSender(Fleet &fleet, const Options &options, double seconds)
+    {
+        const SenderCounters &c = fleet.getCounters();
+        printf("\n=== devices: %d, interval %ld ms, batch %d, %s, %s connections, %.1f s ===\n", options.devices,
+               options.intervalMs, options.batch, options.binary ? "binary" : "JSON",
+               options.keepAlive ? "keep-alive" : "new", seconds);
+        printf("uploads:     %llu sent, %llu accepted (%.2f%%), %.1f/s\n", (unsigned long long)c.requests,
+               (unsigned long long)c.accepted, c.requests ? 100.0 * c.accepted / c.requests : 0.0, c.accepted / seconds);
+        printf("errors:      %llu HTTP, %llu connect, %llu timeout, %llu broken connection\n",
+               (unsigned long long)c.httpErrors, (unsigned long long)c.connectErrors, (unsigned long long)c.timeouts,
+               (unsigned long long)c.brokenConnections);
+        printf("connections: %llu new, %llu reused\n", (unsigned long long)c.newConnections,
+               (unsigned long long)c.reusedConnections);
+        printf("samples:     %llu taken, %llu accepted (%.1f/s), %llu dropped by full buffers, %llu still pending\n",
+               (unsigned long long)c.samplesTaken, (unsigned long long)c.samplesAccepted, c.samplesAccepted / seconds,
+               (unsigned long long)c.samplesDropped, (unsigned long long)fleet.pendingSamples());
+        printf("latency:     p50 %.2f  p90 %.2f  p99 %.2f  p99.9 %.2f  max %.2f ms\n", fleet.all.percentileMs(50),
+               fleet.all.percentileMs(90), fleet.all.percentileMs(99), fleet.all.percentileMs(99.9), fleet.all.maxMs());
+    }
+
+    void summarizeReceiver(const ReceiverCounters &c, double seconds)
+    {
+        printf("receiver:    %llu requests (%llu failed on purpose, %llu invalid), %llu samples, %.1f samples/s, %.1f KB/s\n",
+               (unsigned long long)c.requests, (unsigned long long)c.rejected, (unsigned long long)c.invalid,
+               (unsigned long long)c.samples, c.samples / seconds, c.bytes / seconds / 1024);
+        printf("sequences:   %llu duplicates, %llu missing\n", (unsigned long long)c.duplicates,
+               (unsigned long long)c.gaps);
+    }
+
+    void usage()
+    {
+        fprintf(stderr,
+                "usage: loadgen send|receive|soak [options]\n"
+                "  --server host:port   backend to load (send, default 127.0.0.1:8080)\n"
+                "  --port n             port to listen on (receive, default 8080)\n"
+                "  --devices n          simulated boards (default 100)\n"
+                "  --first-id n         sensor id of the first board (default 1)\n"
+                "  --interval ms        time between two samples of a board (default 10000)\n"
+                "  --batch n            samples per upload, JSON array above 1 (default 1)\n"
+                "  --buffer n           samples a board keeps while uploads fail (default 64)\n"
+                "  --binary             binary body of telemetry.h instead of JSON\n"
+                "  --close              new connection for every upload instead of keep-alive\n"
+                "  --timeout ms         upload timeout (default 5000)\n"
+                "  --duration s         length of the run, 0 until Ctrl-C (default 60)\n"
+                "  --delay ms           receiver: answer after this delay (default 0)\n"
+                "  --fail-percent n     receiver: answer 500 to this share of the uploads (default 0)\n");
+    }
+
+    bool parse(int argc, char **argv, Options &options)
+    {
+        for (int i = 2; i < argc; i++)
+        {
+            std::string name = argv[i];
+            if (name == "--binary")
+            {
+                options.binary = true;
+                continue;
+            }
+            if (name == "--close")
+            {
+                options.keepAlive = false;
+                continue;
+            }
+            if (i + 1 >= argc)
+            {
+                return false;
+            }
+            const char *value = argv[++i];
+            if (name == "--server")
+            {
+                std::string server = value;
+                size_t colon = server.rfind(':');
+                options.host = server.substr(0, colon);
+                if (colon != std::string::npos)
+                {
+                    options.port = (uint16_t)atoi(server.c_str() + colon + 1);
+                }
+            }
+            else if (name == "--port")
+            {
+                options.port = (uint16_t)atoi(value);
+            }
+            else if (name == "--devices")
+            {
+                options.devices = atoi(value);
+            }
+            else if (name == "--first-id")
+            {
+                options.firstId = atoi(value);
+            }
+            else if (name == "--interval")
+            {
+                options.intervalMs = atol(value);
+            }
+            else if (name == "--batch")
+            {
+                options.batch = std::max(1, std::min(255, atoi(value)));
+            }
+            else if (name == "--buffer")
+            {
+                options.buffer = atoi(value);
+            }
+            else if (name == "--timeout")
+            {
+                options.timeoutMs = atol(value);
+            }
+            else if (name == "--duration")
+            {
+                options.durationS = atol(value);
+            }
+            else if (name == "--delay")
+            {
+                options.delayMs = atol(value);
+            }
+            else if (name == "--fail-percent")
+            {
+                options.failPercent = atoi(value);
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return options.devices > 0 && options.intervalMs > 0 && options.buffer >= options.batch;
+    }
+
+    void onSignal(int)
+    {
+        stopRequested = true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    std::string mode = argc > 1 ? argv[1] : "";
+    if ((mode != "send" && mode != "receive" && mode != "soak") || !parse(argc, argv, options))
+    {
+        usage();
+        return 2;
+    }
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+    raiseDescriptorLimit();
+
+    uint64_t start = nowUs();
+    uint64_t end = options.durationS > 0 ? start + (uint64_t)options.durationS * 1000000 : UINT64_MAX;
+
+    if (mode == "receive")
+    {
+        Receiver receiver(options);
+        if (!receiver.bind(options.port))
+        {
+            return 1;
+        }
+        printf("listening on port %u\n", options.port);
+        std::thread server([&receiver]() { receiver.run(); });
+        ReceiverCounters previous;
+        while (!stopRequested && nowUs() < end)
+        {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            // Read without locking: a report may be off by the requests of the current instant
+            ReceiverCounters current = receiver.getCounters();
+            printf("[%5.0f s] receive: %6llu req/s %7llu samples/s, total %llu samples\n", (nowUs() - start) / 1e6,
+                   (unsigned long long)(current.requests - previous.requests),
+                   (unsigned long long)(current.samples - previous.samples), (unsigned long long)current.samples);
+            fflush(stdout);
+            previous = current;
+        }
+        stopRequested = true;
+        server.join();
+        summarizeReceiver(receiver.getCounters(), (nowUs() - start) / 1e6);
+        return 0;
+    }
+
+    Receiver receiver(options);
+    std::thread server;
+    if (mode == "soak")
+    {
+        options.host = "127.0.0.1";
+        options.port = receiver.bind(0);
+        if (options.port == 0)
+        {
+            return 1;
+        }
+        server = std::thread([&receiver]() { receiver.run(); });
+    }
+
+    Fleet fleet(options);
+    if (!fleet.resolve())
+    {
+        return 1;
+    }
+    SenderCounters previous;
+    for (uint64_t next = start + 1000000; !stopRequested && next - 1000000 < end; next += 1000000)
+    {
+        fleet.run(std::min(next, end));
+        reportSender(fleet, (nowUs() - start) / 1e6, previous);
+    }
+    double seconds = (nowUs() - start) / 1e6;
+    summarizeSender(fleet, options, seconds);
+    if (mode == "soak")
+    {
+        stopRequested = true;
+        server.join();
+        summarizeReceiver(receiver.getCounters(), seconds);
+    }
+    return 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  adcSampler.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Samples an analog pin in the background. The ADC runs free and averages 64 conversions in
+ *        hardware into a 12-bit result (oversampling and decimation, about 38 results per second),
+ *        and a DMA channel copies each result into a ring without the CPU. The consumer takes the
+ *        new results with next() and writes a marker in their slot, so no DMA position is needed:
+ *        a slot holding a result (below 4096) has not been taken yet.
+ *
+ *        The ADC then belongs to the sampler, analogRead() must not be used on another pin. The
+ *        DMA channel 0 is used with the descriptor table here, nothing else in the firmware uses
+ *        the DMAC. In deep sleep the ADC clock stops and sampling resumes on wake.
+ *
+ */
+
+#ifndef ADCSAMPLER_H
+#define ADCSAMPLER_H
+
+#include <Arduino.h>
+
+// Results the ring holds, 0.4 s of sampling: the consumer must take them more often than that
+#ifndef ADC_SAMPLER_RING
+#define ADC_SAMPLER_RING 16
+#endif
+// Marker of a slot already taken, the ADC never gives it on 12 bits
+#define ADC_SAMPLER_EMPTY 0xFFFF
+// The results are 12-bit, 4 times the 10-bit analogRead()
+#define ADC_SAMPLER_BITS 12
+
+#if defined(PLANTKEEPER_NATIVE)
+
+#include <NativeHAL.h>
+
+/**
+ * @brief Starts the conversions, the HAL plays the ADC and the DMA from a thread
+ */
+inline void adcSamplerStart(uint8_t pin, volatile uint16_t *ring, size_t size)
+{
+    nativeHal::adcFreeRun(pin, ring, size);
+}
+
+#else
+
+#include "wiring_private.h"
+
+inline void adcSync()
+{
+    while (ADC->STATUS.bit.SYNCBUSY)
+    {
+    }
+}
+
+/**
+ * @brief Starts the conversions of a pin into a ring, the DMA wraps around it forever
+ */
+inline void adcSamplerStart(uint8_t pin, volatile uint16_t *ring, size_t size)
+{
+    // The DMAC reads its descriptors from RAM, 16-byte aligned; the write-back copy is unused
+    // but the DMAC needs somewhere to put it
+    __attribute__((__aligned__(16))) static DmacDescriptor descriptor;
+    __attribute__((__aligned__(16))) static DmacDescriptor writeBack;
+
+    pinPeripheral(pin, PIO_ANALOG);
+
+    // The core configured the reference, the gain and the sampling time for analogRead()
+    ADC->CTRLA.bit.ENABLE = 0;
+    adcSync();
+    ADC->INPUTCTRL.bit.MUXPOS = g_APinDescription[pin].ulADCChannelNumber;
+    adcSync();
+    // 64 conversions accumulated on 18 bits, shifted by 2 automatically and by 4 here: a 12-bit mean
+    ADC->AVGCTRL.reg = ADC_AVGCTRL_SAMPLENUM_64 | ADC_AVGCTRL_ADJRES(4);
+    ADC->CTRLB.reg = ADC_CTRLB_PRESCALER_DIV512 | ADC_CTRLB_RESSEL_16BIT | ADC_CTRLB_FREERUN;
+    adcSync();
+
+    PM->AHBMASK.reg |= PM_AHBMASK_DMAC;
+    PM->APBBMASK.reg |= PM_APBBMASK_DMAC;
+    DMAC->CTRL.reg = 0;
+    DMAC->CTRL.reg = DMAC_CTRL_SWRST;
+    while (DMAC->CTRL.bit.SWRST)
+    {
+    }
+    DMAC->BASEADDR.reg = (uint32_t)&descriptor;
+    DMAC->WRBADDR.reg = (uint32_t)&writeBack;
+    DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xF);
+
+    // One 16-bit beat per result ready; with an incremented destination the DMAC wants the end
+    // address, and the descriptor links to itself so the block restarts at the top of the ring
+    descriptor.BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_HWORD | DMAC_BTCTRL_DSTINC;
+    descriptor.BTCNT.reg = (uint16_t)size;
+    descriptor.SRCADDR.reg = (uint32_t)&ADC->RESULT.reg;
+    descriptor.DSTADDR.reg = (uint32_t)(ring + size);
+    descriptor.DESCADDR.reg = (uint32_t)&descriptor;
+
+    DMAC->CHID.reg = DMAC_CHID_ID(0);
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_SWRST;
+    while (DMAC->CHCTRLA.bit.SWRST)
+    {
+    }
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_LVL(0) | DMAC_CHCTRLB_TRIGSRC(ADC_DMAC_ID_RESRDY) | DMAC_CHCTRLB_TRIGACT_BEAT;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+
+    ADC->CTRLA.bit.ENABLE = 1;
+    adcSync();
+    // Free running: the first conversion starts the next ones
+    ADC->SWTRIG.bit.START = 1;
+    adcSync();
+}
+
+#endif
+
+/**
+ * @brief Ring of the results of one analog pin
+ */
+template <uint8_t Pin>
+class AdcSampler
+{
+public:
+    AdcSampler() : readIndex(0)
+    {
+        for (size_t i = 0; i < ADC_SAMPLER_RING; i++)
+        {
+            ring[i] = ADC_SAMPLER_EMPTY;
+        }
+    }
+
+    void begin()
+    {
+        adcSamplerStart(Pin, ring, ADC_SAMPLER_RING);
+    }
+
+    /**
+     * @brief Takes the oldest result not taken yet
+     * @return false when the ADC has not produced a new result
+     */
+    bool next(uint16_t &result)
+    {
+        uint16_t value = ring[readIndex];
+        if (value == ADC_SAMPLER_EMPTY)
+        {
+            return false;
+        }
+        ring[readIndex] = ADC_SAMPLER_EMPTY;
+        readIndex = (readIndex + 1) % ADC_SAMPLER_RING;
+        result = value;
+        return true;
+    }
+
+private:
+    // Written by the DMA
+    volatile uint16_t ring[ADC_SAMPLER_RING];
+    size_t readIndex;
+};
+
+#endif
@@ -0,0 +1,196 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  clockSync.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Unix time of the samples, from the uptime they were taken at. The WiFi module gives the time
+ *        it got by NTP, in whole seconds; the board counts with its own oscillator, which is off by
+ *        some tens of ppm, so a single reading drifts by seconds a day. The clock is read again
+ *        periodically: the uptime elapsed since the anchor (the first reading) against the Unix
+ *        time elapsed gives the drift, corrected in every time computed. A reading further
+ *        than CLOCK_STEP_MS from the prediction (before the first estimate, from what the largest
+ *        drift explains) is a jump of the module time, which corrected its own, and moves the anchor.
+ *
+ */
+
+#ifndef CLOCKSYNC_H
+#define CLOCKSYNC_H
+
+#include <stdint.h>
+
+// Time between two readings of the WiFi module time, in ms
+#ifndef CLOCK_SYNC_INTERVAL
+#define CLOCK_SYNC_INTERVAL 3600000UL
+#endif
+// Shortest time elapsed since the anchor to estimate the drift: readings are in whole seconds,
+// after a day the error of the estimate is about 12 ppm
+#ifndef CLOCK_DRIFT_BASELINE
+#define CLOCK_DRIFT_BASELINE 86400000UL
+#endif
+// The anchor moves after this time so the elapsed uptime stays far from the wrap of unsigned long
+#ifndef CLOCK_ANCHOR_MAX
+#define CLOCK_ANCHOR_MAX (7 * 86400000UL)
+#endif
+// Error of a reading above which the anchor moves to it; the prediction is within a second or two
+#ifndef CLOCK_STEP_MS
+#define CLOCK_STEP_MS 5000
+#endif
+// Largest drift believed, the crystal of the board is far better; more means a wrong reading
+#ifndef CLOCK_MAX_DRIFT_PPM
+#define CLOCK_MAX_DRIFT_PPM 500
+#endif
+
+class ClockSync
+{
+public:
+    ClockSync()
+        : known(false), estimated(false), anchorUnixMs(0), anchorUptime(0), lastSync(0), driftPpm(0),
+          lastError(0), syncs(0), steps(0)
+    {
+    }
+
+    /**
+     * @brief Whether the clock should be read again
+     * @param now uptime()
+     */
+    bool due(unsigned long now) const
+    {
+        return !known || now - lastSync >= CLOCK_SYNC_INTERVAL;
+    }
+
+    /**
+     * @brief Takes a reading of the Unix time
+     * @param unixSeconds The time given by the WiFi module, 0 when it has none yet (ignored)
+     * @param now uptime() when it was read
+     */
+    void sync(uint32_t unixSeconds, unsigned long now)
+    {
+        if (unixSeconds == 0)
+        {
+            return;
+        }
+        // The second started somewhere in the last 1000 ms
+        int64_t observed = (int64_t)unixSeconds * 1000 + 500;
+        lastSync = now;
+        syncs++;
+        if (!known)
+        {
+            anchor(observed, now);
+            known = true;
+            return;
+        }
+
+        int32_t elapsed = (int32_t)(now - anchorUptime);
+        lastError = (int32_t)(observed - unixMs(now));
+        // Time the board lost since the anchor; until the drift is estimated, the largest one
+        // could explain it, then the prediction should be close
+        int64_t lost = observed - anchorUnixMs - elapsed;
+        int64_t explained = CLOCK_STEP_MS;
+        if (!estimated)
+        {
+            explained += (int64_t)elapsed * CLOCK_MAX_DRIFT_PPM / 1000000;
+        }
+        int64_t error = estimated ? lastError : lost;
+        if (error > explained || error < -explained)
+        {
+            steps++;
+            anchor(observed, now);
+            return;
+        }
+        if (elapsed >= (int32_t)CLOCK_DRIFT_BASELINE)
+        {
+            int64_t ppm = lost * 1000000 / elapsed;
+            if (ppm > CLOCK_MAX_DRIFT_PPM)
+            {
+                ppm = CLOCK_MAX_DRIFT_PPM;
+            }
+            else if (ppm < -CLOCK_MAX_DRIFT_PPM)
+            {
+                ppm = -CLOCK_MAX_DRIFT_PPM;
+            }
+            driftPpm = (int32_t)ppm;
+            estimated = true;
+        }
+        if (elapsed >= (int32_t)CLOCK_ANCHOR_MAX)
+        {
+            // The prediction is as good as the reading and keeps the sub-second part
+            anchor(unixMs(now), now);
+        }
+    }
+
+    /**
+     * @brief Unix time of an uptime of this boot, in seconds; 0 while the clock is not known
+     * @param at The uptime, before or after the anchor
+     */
+    uint32_t unixTime(unsigned long at) const
+    {
+        return known ? (uint32_t)(unixMs(at) / 1000) : 0;
+    }
+
+    bool isKnown() const
+    {
+        return known;
+    }
+
+    /**
+     * @brief Estimated drift of the board oscillator, in ppm; positive when it runs slow
+     */
+    int32_t drift() const
+    {
+        return driftPpm;
+    }
+
+    /**
+     * @brief Last reading minus its prediction, in ms
+     */
+    int32_t lastSyncError() const
+    {
+        return lastError;
+    }
+
+    uint32_t syncCount() const
+    {
+        return syncs;
+    }
+
+    /**
+     * @brief Readings too far from the prediction, that moved the anchor
+     */
+    uint32_t stepCount() const
+    {
+        return steps;
+    }
+
+private:
+    void anchor(int64_t unixMsNow, unsigned long now)
+    {
+        anchorUnixMs = unixMsNow;
+        anchorUptime = now;
+    }
+
+    int64_t unixMs(unsigned long at) const
+    {
+        int64_t elapsed = (int32_t)(at - anchorUptime);
+        return anchorUnixMs + elapsed + elapsed * driftPpm / 1000000;
+    }
+
+    bool known;
+    bool estimated;
+    int64_t anchorUnixMs;
+    unsigned long anchorUptime;
+    unsigned long lastSync;
+    int32_t driftPpm;
+    int32_t lastError;
+    uint32_t syncs;
+    uint32_t steps;
+};
+
+#endif
@@ -0,0 +1,125 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  configStore.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Configuration of the board (WiFi credentials and sensor id) kept in the internal flash, so a
+ *        power cycle does not send the board back to the access point mode.
+ *
+ *        The region has two rows and a save always erases and writes the row that does not hold the
+ *        current configuration, the newest valid one wins. A power loss during a save therefore keeps
+ *        the previous configuration instead of losing both.
+ *
+ */
+
+#ifndef CONFIGSTORE_H
+#define CONFIGSTORE_H
+
+#include <Arduino.h>
+#include "flashStorage.h"
+
+#define CONFIG_STORE_ROWS 2
+#define CONFIG_MAGIC 0x32434B50 // "PKC2", the SSID field grew to 33 bytes
+
+/**
+ * @brief The configuration as stored, at the start of a row
+ */
+struct StoredConfig
+{
+    uint32_t magic;
+    uint32_t generation;  // Incremented by every save
+    char ssid[33];        // Up to 32 bytes and the terminator
+    char pass[64];        // Up to 63 characters (WPA) and the terminator
+    uint16_t sensorId;
+    uint8_t reserved[16]; // Room for new fields, written as 0
+    uint32_t crc;         // CRC-32 of the fields above
+};
+
+static_assert(sizeof(StoredConfig) % FLASH_PAGE_SIZE == 0, "The configuration must fill whole pages");
+static_assert(sizeof(StoredConfig) <= FLASH_ROW_SIZE, "The configuration must fit in a row");
+
+class ConfigStore
+{
+public:
+    explicit ConfigStore(const uint8_t *region) : region(region) {}
+
+    /**
+     * @brief Copies the last saved configuration
+     * @param out Destination of the configuration
+     * @return false if none was saved or both rows are damaged
+     */
+    bool load(StoredConfig &out) const
+    {
+        const StoredConfig *current = latest();
+        if (!current)
+        {
+            return false;
+        }
+        out = *current;
+        return true;
+    }
+
+    /**
+     * @brief Saves a configuration, unless it is the one already stored. Erases and programs a row,
+     *        about 11 ms during which the CPU is stalled.
+     */
+    void save(const char *ssid, const char *pass, uint16_t sensorId)
+    {
+        StoredConfig config;
+        memset(&config, 0, sizeof(config));
+        config.magic = CONFIG_MAGIC;
+        strncpy(config.ssid, ssid, sizeof(config.ssid) - 1);
+        strncpy(config.pass, pass, sizeof(config.pass) - 1);
+        config.sensorId = sensorId;
+
+        const StoredConfig *current = latest();
+        if (current && strcmp(current->ssid, config.ssid) == 0 && strcmp(current->pass, config.pass) == 0 &&
+            current->sensorId == config.sensorId)
+        {
+            return;
+        }
+        config.generation = current ? current->generation + 1 : 1;
+        config.crc = crc32(&config, offsetof(StoredConfig, crc));
+
+        const uint8_t *row = region + (current == at(0) ? FLASH_ROW_SIZE : 0);
+        flashEraseRow(row);
+        flashWrite(row, &config, sizeof(config));
+    }
+
+private:
+    const StoredConfig *at(size_t row) const
+    {
+        return reinterpret_cast<const StoredConfig *>(region + row * FLASH_ROW_SIZE);
+    }
+
+    static bool isValid(const StoredConfig &config)
+    {
+        return config.magic == CONFIG_MAGIC && config.crc == crc32(&config, offsetof(StoredConfig, crc));
+    }
+
+    const StoredConfig *latest() const
+    {
+        const StoredConfig *best = nullptr;
+        for (size_t row = 0; row < CONFIG_STORE_ROWS; row++)
+        {
+            const StoredConfig *config = at(row);
+            if (isValid(*config) && (!best || (int32_t)(config->generation - best->generation) > 0))
+            {
+                best = config;
+            }
+        }
+        return best;
+    }
+
+    const uint8_t *region;
+};
+
+#endif
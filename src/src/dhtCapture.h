@@ -0,0 +1,315 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  dhtCapture.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Reads a DHT11 or DHT22 in the background. The Adafruit driver bit-bangs the protocol with
+ *        the interrupts disabled for about 5 ms, after holding the line low for 20 ms; here poll()
+ *        holds the start signal across loop() passes, then the 40 bits are decoded by an interrupt
+ *        on each falling edge of the data line. loop() only pays for a few microseconds per edge and
+ *        keeps the last reading whose checksum matched, with its age.
+ *
+ *        A bit is a 50 us low pulse followed by a high pulse of 26-28 us for a 0 and 70 us for a 1,
+ *        so the time between two falling edges tells the bit. The sensor answers 20-40 us after the
+ *        line is released, about what attachInterrupt() takes on the SAMD21: the interrupt is
+ *        attached before the start signal and its edges are ignored until the release.
+ *
+ */
+
+#ifndef DHTCAPTURE_H
+#define DHTCAPTURE_H
+
+#include <Arduino.h>
+#include "DHT.h"
+
+// Minimum time between two conversions, the DHT11 cannot be read more often
+#ifndef DHT_CAPTURE_INTERVAL
+#define DHT_CAPTURE_INTERVAL 2000
+#endif
+// Falling edges of a transfer: start of the response, start of the first bit, end of each bit
+#define DHT_CAPTURE_EDGES 42
+// Edge to edge time above which a bit is a 1: 77 us for a 0, 120 us for a 1
+#define DHT_CAPTURE_ONE_US 100
+// Time after which a transfer that has not produced all its edges is given up
+#define DHT_CAPTURE_TIMEOUT_US 10000
+
+/**
+ * @brief Whether a pin of the MKR boards is wired to an external interrupt line: 0, 1, 4 to 9, A1
+ *        and A2. attachInterrupt() silently does nothing on the others, D2 and D3 included.
+ */
+constexpr bool hasExternalInterrupt(uint8_t pin)
+{
+    return pin == 0 || pin == 1 || (pin >= 4 && pin <= 9) || pin == 16 || pin == 17;
+}
+
+#if defined(PLANTKEEPER_NATIVE)
+
+/**
+ * @brief Releases the data line to the pull-up, the interrupt stays attached
+ */
+inline void dhtReleaseLine(uint8_t pin)
+{
+    pinMode(pin, INPUT_PULLUP);
+}
+
+#else
+
+#include "wiring_private.h"
+
+/**
+ * @brief Releases the data line to the pull-up. pinMode() also took the pin from the EIC, which
+ *        attachInterrupt() had configured; giving it back is a single write of the pin mux.
+ */
+inline void dhtReleaseLine(uint8_t pin)
+{
+    pinMode(pin, INPUT_PULLUP);
+    pinPeripheral(pin, PIO_EXTINT);
+}
+
+#endif
+
+/**
+ * @brief Conversions of the sensor since boot
+ */
+struct DhtCaptureStats
+{
+    uint32_t readings;       // Transfers with a valid checksum
+    uint32_t timeouts;       // Transfers with missing edges, the sensor did not answer or an edge was lost
+    uint32_t checksumErrors; // Transfers whose data did not match the checksum
+};
+
+template <uint8_t Pin, uint8_t Type>
+class DhtCapture
+{
+    static_assert(hasExternalInterrupt(Pin),
+                  "DhtCapture needs a pin with an external interrupt: 0, 1, 4 to 9, A1 or A2");
+
+public:
+    DhtCapture()
+        : state(IDLE), started(false), startedAt(0), receiveStartUs(0), listening(false), edges(0), lastEdgeUs(0),
+          bits(), valid(false), validAt(0), temperature(0), humidity(0), stats()
+    {
+    }
+
+    void begin()
+    {
+        instance = this;
+        pinMode(Pin, INPUT_PULLUP);
+    }
+
+    /**
+     * @brief Advances the conversion, to be called often from loop(). Never waits.
+     */
+    void poll()
+    {
+        unsigned long now = millis();
+        switch (state)
+        {
+        case IDLE:
+            if (started && now - startedAt < DHT_CAPTURE_INTERVAL)
+            {
+                return;
+            }
+            // Start signal: the line is held low, then released to let the sensor answer. The
+            // interrupt is ready long before the release, the edge of the start signal is ignored.
+            listening = false;
+            attachInterrupt(digitalPinToInterrupt(Pin), onFallingEdge, FALLING);
+            pinMode(Pin, OUTPUT);
+            digitalWrite(Pin, LOW);
+            started = true;
+            startedAt = now;
+            state = START_SIGNAL;
+            return;
+
+        case START_SIGNAL:
+            // At least 18 ms for the DHT11, 1 ms for the DHT22
+            if (now - startedAt < (Type == DHT11 ? 20UL : 2UL))
+            {
+                return;
+            }
+            memset((void *)bits, 0, sizeof(bits));
+            edges = 0;
+            listening = true;
+            dhtReleaseLine(Pin);
+            receiveStartUs = micros();
+            state = RECEIVING;
+            return;
+
+        case RECEIVING:
+            if (edges < DHT_CAPTURE_EDGES && micros() - receiveStartUs < DHT_CAPTURE_TIMEOUT_US)
+            {
+                return;
+            }
+            detachInterrupt(digitalPinToInterrupt(Pin));
+            listening = false;
+            state = IDLE;
+            decode();
+            return;
+        }
+    }
+
+    /**
+     * @brief Accounts for time during which millis() stood still (deep sleep): the gap between two
+     *        conversions and the age of the reading include it, so a conversion starts on the wake
+     *        after a sleep longer than DHT_CAPTURE_INTERVAL
+     */
+    void advance(unsigned long ms)
+    {
+        if (state == IDLE)
+        {
+            startedAt -= ms;
+        }
+        validAt -= ms;
+    }
+
+    /**
+     * @brief Whether a conversion is in progress, the CPU must then stay awake
+     */
+    bool busy() const
+    {
+        return state != IDLE;
+    }
+
+    /**
+     * @brief Whether a reading was validated since boot
+     */
+    bool hasReading() const
+    {
+        return valid;
+    }
+
+    /**
+     * @brief Temperature of the last valid reading, in hundredths of degree Celsius
+     */
+    int16_t lastTemperature() const
+    {
+        return temperature;
+    }
+
+    /**
+     * @brief Relative humidity of the last valid reading, in hundredths of percent
+     */
+    int16_t lastHumidity() const
+    {
+        return humidity;
+    }
+
+    /**
+     * @brief Time since the last valid reading
+     */
+    unsigned long readingAgeMs() const
+    {
+        return millis() - validAt;
+    }
+
+    const DhtCaptureStats &getStats() const
+    {
+        return stats;
+    }
+
+private:
+    enum State
+    {
+        IDLE,
+        START_SIGNAL,
+        RECEIVING
+    };
+
+    static void onFallingEdge()
+    {
+        instance->edge();
+    }
+
+    /**
+     * @brief Interrupt handler, the first two edges end the response of the sensor and the next 40
+     *        end a bit each
+     */
+    void edge()
+    {
+        unsigned long now = micros();
+        uint8_t index = edges;
+        if (!listening || index >= DHT_CAPTURE_EDGES)
+        {
+            return;
+        }
+        if (index >= 2 && now - lastEdgeUs > DHT_CAPTURE_ONE_US)
+        {
+            uint8_t bit = index - 2;
+            bits[bit / 8] |= (uint8_t)(0x80 >> (bit % 8));
+        }
+        lastEdgeUs = now;
+        edges = index + 1;
+    }
+
+    void decode()
+    {
+        if (edges < DHT_CAPTURE_EDGES)
+        {
+            stats.timeouts++;
+            return;
+        }
+        uint8_t data[5];
+        memcpy(data, (const void *)bits, sizeof(data));
+        if ((uint8_t)(data[0] + data[1] + data[2] + data[3]) != data[4])
+        {
+            stats.checksumErrors++;
+            return;
+        }
+
+        if (Type == DHT11)
+        {
+            // Integer and tenths, the sign is the top bit of the tenths (same decoding as the Adafruit driver)
+            humidity = (int16_t)(data[0] * 100 + data[1] * 10);
+            temperature = (int16_t)(data[2] * 100 + (data[3] & 0x0F) * 10);
+            if (data[3] & 0x80)
+            {
+                temperature = (int16_t)((data[3] & 0x0F) * 10 - (data[2] + 1) * 100);
+            }
+        }
+        else
+        {
+            // Tenths on 16 bits, the temperature in sign and magnitude
+            humidity = (int16_t)((data[0] << 8 | data[1]) * 10);
+            temperature = (int16_t)(((data[2] & 0x7F) << 8 | data[3]) * 10);
+            if (data[2] & 0x80)
+            {
+                temperature = (int16_t)-temperature;
+            }
+        }
+        valid = true;
+        validAt = millis();
+        stats.readings++;
+    }
+
+    static DhtCapture *instance;
+
+    State state;
+    bool started;
+    unsigned long startedAt;
+    unsigned long receiveStartUs;
+    // Edges count once the line is released
+    volatile bool listening;
+    // Written by the interrupt handler
+    volatile uint8_t edges;
+    volatile unsigned long lastEdgeUs;
+    volatile uint8_t bits[5];
+
+    bool valid;
+    unsigned long validAt;
+    int16_t temperature;
+    int16_t humidity;
+    DhtCaptureStats stats;
+};
+
+template <uint8_t Pin, uint8_t Type>
+DhtCapture<Pin, Type> *DhtCapture<Pin, Type>::instance = nullptr;
+
+#endif
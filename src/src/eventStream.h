@@ -0,0 +1,177 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  eventStream.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Server-Sent Events: connections detached from the web server that stay open and receive
+ *        each event as a few lines of text. An event is formatted once and written to every
+ *        subscriber; a subscriber that does not take it whole or has gone is dropped, the browser
+ *        reconnects by itself.
+ *
+ */
+
+#ifndef EVENTSTREAM_H
+#define EVENTSTREAM_H
+
+#include <Arduino.h>
+#include <WiFiNINA.h>
+
+// Open streams at most, each takes one of the 10 sockets of the NINA module
+#ifndef EVENT_STREAM_SUBSCRIBERS
+#define EVENT_STREAM_SUBSCRIBERS 2
+#endif
+// Longest event, name and data included
+#ifndef EVENT_STREAM_MESSAGE
+#define EVENT_STREAM_MESSAGE 192
+#endif
+// A comment is sent after that long without an event, so a dead connection is found
+#define EVENT_STREAM_KEEPALIVE 15000
+// Delay the browser waits before reconnecting a lost stream
+#define EVENT_STREAM_RETRY 5000
+
+class EventStream
+{
+public:
+    EventStream() : active(), lastSent(0), sent(0), dropped(0) {}
+
+    /**
+     * @brief Answers a request with the stream headers and keeps its connection
+     * @param client The client of the request, the web server must be told to not close it
+     * @return false when every stream is taken, nothing was written
+     */
+    bool subscribe(WiFiClient &client)
+    {
+        for (size_t i = 0; i < EVENT_STREAM_SUBSCRIBERS; i++)
+        {
+            if (!active[i])
+            {
+                client.print(F("HTTP/1.1 200 OK\r\n"
+                               "Content-Type: text/event-stream\r\n"
+                               "Cache-Control: no-cache\r\n"
+                               "Connection: keep-alive\r\n"
+                               "\r\n"
+                               "retry: "));
+                client.print(EVENT_STREAM_RETRY);
+                client.print(F("\n\n"));
+                subscribers[i] = client;
+                active[i] = true;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Sends an event to every subscriber
+     * @param name The event type, listened to with addEventListener()
+     * @param data The data, on one line
+     */
+    void publish(const char *name, const char *data)
+    {
+        int length = snprintf(message, sizeof(message), "event: %s\ndata: %s\n\n", name, data);
+        if (length > 0 && (size_t)length < sizeof(message))
+        {
+            send(message, (size_t)length);
+            sent++;
+        }
+    }
+
+    /**
+     * @brief Drops the closed streams and keeps the others alive, to be called from loop()
+     */
+    void poll()
+    {
+        for (size_t i = 0; i < EVENT_STREAM_SUBSCRIBERS; i++)
+        {
+            if (active[i] && !subscribers[i].connected())
+            {
+                drop(i);
+            }
+        }
+        if (millis() - lastSent >= EVENT_STREAM_KEEPALIVE)
+        {
+            send(":\n\n", 3);
+        }
+    }
+
+    void closeAll()
+    {
+        for (size_t i = 0; i < EVENT_STREAM_SUBSCRIBERS; i++)
+        {
+            if (active[i])
+            {
+                subscribers[i].stop();
+                active[i] = false;
+            }
+        }
+    }
+
+    /**
+     * @brief Number of open streams
+     */
+    size_t size() const
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < EVENT_STREAM_SUBSCRIBERS; i++)
+        {
+            if (active[i])
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Events published since boot
+     */
+    uint32_t sentCount() const
+    {
+        return sent;
+    }
+
+    /**
+     * @brief Streams dropped since boot, closed by the browser or too slow
+     */
+    uint32_t droppedCount() const
+    {
+        return dropped;
+    }
+
+private:
+    void send(const char *text, size_t length)
+    {
+        lastSent = millis();
+        for (size_t i = 0; i < EVENT_STREAM_SUBSCRIBERS; i++)
+        {
+            if (active[i] && subscribers[i].write((const uint8_t *)text, length) != length)
+            {
+                drop(i);
+            }
+        }
+    }
+
+    void drop(size_t index)
+    {
+        subscribers[index].stop();
+        active[index] = false;
+        dropped++;
+    }
+
+    WiFiClient subscribers[EVENT_STREAM_SUBSCRIBERS];
+    bool active[EVENT_STREAM_SUBSCRIBERS];
+    char message[EVENT_STREAM_MESSAGE];
+    unsigned long lastSent;
+    uint32_t sent;
+    uint32_t dropped;
+};
+
+#endif
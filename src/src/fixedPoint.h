@@ -0,0 +1,104 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  fixedPoint.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Integer helpers of the sensor pipeline. The SAMD21 has no FPU and every float operation is
+ *        a call into the soft-float library, so a reading is turned into an integer with a fixed scale
+ *        as soon as it leaves the sensor driver, and only turned into decimal text to be shown or sent.
+ *
+ */
+
+#ifndef FIXEDPOINT_H
+#define FIXEDPOINT_H
+
+#include <Arduino.h>
+
+// Longest text written by formatFixed(): sign, 10 digits, decimal point and terminator
+#define FIXED_TEXT_SIZE 13
+
+/**
+ * @brief Converts a value given by a driver to fixed point, rounded to the nearest step
+ * @param value The value, not NaN
+ * @param scale Number of steps per unit, 100 for hundredths
+ */
+inline int32_t toFixed(float value, int32_t scale)
+{
+    return (int32_t)(value * scale + (value < 0 ? -0.5f : 0.5f));
+}
+
+/**
+ * @brief Like map(), but the value is first clamped to the input range so the result stays in the
+ *        output range. The ranges are compile-time constants and may be decreasing.
+ */
+template <long InMin, long InMax, long OutMin, long OutMax>
+inline long mapClamped(long value)
+{
+    static_assert(InMin != InMax, "The input range must not be empty");
+    const long low = InMin < InMax ? InMin : InMax;
+    const long high = InMin < InMax ? InMax : InMin;
+    value = constrain(value, low, high);
+    return (value - InMin) * (OutMax - OutMin) / (InMax - InMin) + OutMin;
+}
+
+/**
+ * @brief Writes a fixed point value as decimal text, with one decimal per power of ten of the scale
+ *        ("-1.05" for -105 in hundredths)
+ * @param buffer Destination, at least FIXED_TEXT_SIZE bytes
+ * @param value The value
+ * @param scale Number of steps per unit, a power of ten
+ * @return Length of the text
+ */
+inline size_t formatFixed(char *buffer, int32_t value, int32_t scale)
+{
+    char digits[FIXED_TEXT_SIZE - 1];
+    size_t position = sizeof(digits);
+    uint32_t magnitude = value < 0 ? 0U - (uint32_t)value : (uint32_t)value;
+    for (int32_t step = 1; step < scale; step *= 10)
+    {
+        digits[--position] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    }
+    if (scale > 1)
+    {
+        digits[--position] = '.';
+    }
+    do
+    {
+        digits[--position] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+    if (value < 0)
+    {
+        digits[--position] = '-';
+    }
+
+    size_t length = sizeof(digits) - position;
+    memcpy(buffer, &digits[position], length);
+    buffer[length] = '\0';
+    return length;
+}
+
+/**
+ * @brief Decimal text of a fixed point value, for use within one expression:
+ *        out.print(FixedText(value, 100).text)
+ */
+struct FixedText
+{
+    FixedText(int32_t value, int32_t scale)
+    {
+        formatFixed(text, value, scale);
+    }
+
+    char text[FIXED_TEXT_SIZE];
+};
+
+#endif
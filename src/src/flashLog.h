@@ -0,0 +1,357 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  flashLog.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Append-only log of samples in the internal flash, used to keep the samples that could not
+ *        be uploaded across power loss and replay them in order.
+ *
+ *        The log is a circular sequence of 64 byte records over the whole region, so every row is
+ *        erased as often as the others. Each record carries the sequence number of its sample and a
+ *        CRC: after a power loss the log is rebuilt by scanning the region, and a record torn by the
+ *        cut is simply ignored. Uploaded records are marked by programming their last word to zero,
+ *        without erasing. Each boot also writes a record already marked, so the boot number and the
+ *        sequence numbers go on from it even when no sample had to be kept. Every public method
+ *        performs at most one flash operation so the caller decides when the few milliseconds of
+ *        stall happen.
+ *
+ */
+
+#ifndef FLASHLOG_H
+#define FLASHLOG_H
+
+#include <Arduino.h>
+#include "flashStorage.h"
+#include "sensorData.h"
+
+// What is left of a flash page after the sample and the 16 bytes of the other fields
+#define LOGGED_SAMPLE_RESERVED (FLASH_PAGE_SIZE - 16 - sizeof(sensorSample))
+
+/**
+ * @brief One sample as stored in the log, one record per flash page
+ */
+struct LoggedSample
+{
+    uint32_t time;        // Unix time in seconds, 0 when the clock was not known
+    sensorSample sample;
+    uint16_t sensorId;
+    uint16_t boot;        // Boot during which the sample was taken, sample.takenAt is only meaningful in it
+    uint8_t reserved[LOGGED_SAMPLE_RESERVED]; // Room for new fields, written as 0xFF
+    uint32_t crc;         // CRC-32 of the fields above
+    uint32_t sent;        // All ones while pending, programmed to 0 once uploaded
+};
+
+static_assert(sizeof(LoggedSample) == FLASH_PAGE_SIZE, "A record must fill a flash page");
+
+class FlashLog
+{
+public:
+    FlashLog(const uint8_t *region, size_t rows)
+        : region(region), slots(rows * recordsPerRow), head(0), tail(0), markCursor(0), pending(0),
+          nextSequence(1), boot(0), dropped(0)
+    {
+    }
+
+    /**
+     * @brief Rebuilds the state of the log from the flash content, to be called once in setup()
+     */
+    void begin()
+    {
+        bool found = false;
+        uint32_t lastSequence = 0;
+        uint32_t oldestPendingSequence = 0;
+        uint16_t lastBoot = 0;
+        size_t lastSlot = 0;
+        pending = 0;
+
+        for (size_t slot = 0; slot < slots; slot++)
+        {
+            const LoggedSample &record = at(slot);
+            if (!isValid(record))
+            {
+                continue;
+            }
+            if (!found || record.sample.sequence > lastSequence)
+            {
+                lastSequence = record.sample.sequence;
+                lastSlot = slot;
+                lastBoot = record.boot;
+            }
+            if (record.sent != 0)
+            {
+                if (pending == 0 || record.sample.sequence < oldestPendingSequence)
+                {
+                    oldestPendingSequence = record.sample.sequence;
+                    tail = slot;
+                }
+                pending++;
+            }
+            found = true;
+        }
+
+        if (found)
+        {
+            nextSequence = lastSequence + 1;
+            boot = lastBoot + 1;
+            head = (lastSlot + 1) % slots;
+            // A record torn by a power cut leaves a dirty slot after the last valid one
+            while (head % recordsPerRow != 0 && !isBlank(head))
+            {
+                head = (head + 1) % slots;
+            }
+        }
+        if (pending == 0)
+        {
+            tail = head;
+        }
+        markCursor = tail;
+    }
+
+    /**
+     * @brief Appends a sample. When the next row has to be erased first, only the erase is done and
+     *        false is returned: the caller tries again on a later loop().
+     * @param record The sample, boot and CRC are filled in by the log. Its sequence number must come
+     *               from takeSequence() so the order of the log survives a reboot.
+     * @return Whether the record was written
+     */
+    bool append(LoggedSample record)
+    {
+        if (!write(record, 0xFFFFFFFF))
+        {
+            return false;
+        }
+        if (pending == 0)
+        {
+            tail = (head + slots - 1) % slots;
+        }
+        pending++;
+        return true;
+    }
+
+    /**
+     * @brief Records the boot, to be called after begin(): the next boot gets the following number
+     *        and the samples of this one sequence numbers above this record. Returns false after an
+     *        erase like append().
+     */
+    bool recordBoot()
+    {
+        LoggedSample record;
+        memset(&record, 0, sizeof(record));
+        record.sample.sequence = nextSequence;
+        if (!write(record, 0))
+        {
+            return false;
+        }
+        nextSequence++;
+        return true;
+    }
+
+    /**
+     * @brief Copies the oldest pending records, in the order they were appended
+     * @param out Destination of the records
+     * @param max Number of records wanted
+     * @return Number of records copied
+     */
+    size_t peek(LoggedSample *out, size_t max) const
+    {
+        size_t count = 0;
+        size_t slot = tail;
+        for (size_t step = 0; step < slots && count < max && count < pending; step++)
+        {
+            if (isPending(at(slot)))
+            {
+                out[count++] = at(slot);
+            }
+            slot = (slot + 1) % slots;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Marks the n oldest pending records as uploaded. The marks are programmed later, one per
+     *        call to service(); a power cut before that only means the records are sent again.
+     */
+    void consume(size_t n)
+    {
+        for (size_t step = 0; step < slots && n > 0 && pending > 0; step++)
+        {
+            if (isPending(at(tail)))
+            {
+                n--;
+                pending--;
+            }
+            tail = (tail + 1) % slots;
+        }
+        if (pending == 0)
+        {
+            tail = head;
+        }
+    }
+
+    /**
+     * @brief Programs at most one pending "sent" mark
+     */
+    void service()
+    {
+        while (markCursor != tail)
+        {
+            size_t slot = markCursor;
+            markCursor = (markCursor + 1) % slots;
+            const LoggedSample &record = at(slot);
+            if (isPending(record))
+            {
+                const uint32_t sent = 0;
+                flashWrite(&record.sent, &sent, sizeof(sent));
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Hands out the sequence number of a new sample, above every one found in the log at boot
+     */
+    uint32_t takeSequence()
+    {
+        return nextSequence++;
+    }
+
+    size_t pendingCount() const
+    {
+        return pending;
+    }
+
+    size_t capacity() const
+    {
+        return slots;
+    }
+
+    uint16_t bootNumber() const
+    {
+        return boot;
+    }
+
+    /**
+     * @brief Number of pending records erased because the log wrapped around onto them
+     */
+    uint32_t droppedCount() const
+    {
+        return dropped;
+    }
+
+private:
+    static const size_t recordsPerRow = FLASH_ROW_SIZE / sizeof(LoggedSample);
+
+    const LoggedSample &at(size_t slot) const
+    {
+        return reinterpret_cast<const LoggedSample *>(region)[slot];
+    }
+
+    bool isValid(const LoggedSample &record) const
+    {
+        return record.crc == crc32(&record, offsetof(LoggedSample, crc));
+    }
+
+    /**
+     * @brief Valid and not uploaded, boot records are written as uploaded
+     */
+    bool isPending(const LoggedSample &record) const
+    {
+        return record.sent != 0 && isValid(record);
+    }
+
+    /**
+     * @brief Writes a record at the head, or only erases the row there if it has to be first
+     * @param sent Its "sent" word
+     */
+    bool write(LoggedSample &record, uint32_t sent)
+    {
+        if (head % recordsPerRow == 0 && !isRowBlank(head / recordsPerRow))
+        {
+            dropRow(head / recordsPerRow);
+            flashEraseRow(region + head * sizeof(LoggedSample));
+            return false;
+        }
+
+        record.boot = boot;
+        memset(record.reserved, 0xFF, sizeof(record.reserved));
+        record.crc = crc32(&record, offsetof(LoggedSample, crc));
+        record.sent = sent;
+        flashWrite(region + head * sizeof(LoggedSample), &record, sizeof(record));
+        head = (head + 1) % slots;
+        return true;
+    }
+
+    bool isBlank(size_t slot) const
+    {
+        const uint32_t *words = reinterpret_cast<const uint32_t *>(&at(slot));
+        for (size_t i = 0; i < sizeof(LoggedSample) / 4; i++)
+        {
+            if (words[i] != 0xFFFFFFFF)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool isRowBlank(size_t row) const
+    {
+        for (size_t slot = row * recordsPerRow; slot < (row + 1) * recordsPerRow; slot++)
+        {
+            if (!isBlank(slot))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Forgets the pending records of a row that is about to be erased
+     */
+    void dropRow(size_t row)
+    {
+        size_t first = row * recordsPerRow;
+        size_t last = first + recordsPerRow;
+        for (size_t slot = first; slot < last && pending > 0; slot++)
+        {
+            if (slot == tail)
+            {
+                if (isPending(at(slot)))
+                {
+                    pending--;
+                    dropped++;
+                }
+                tail = (tail + 1) % slots;
+            }
+        }
+        if (pending == 0)
+        {
+            tail = head;
+        }
+        if (markCursor >= first && markCursor < last)
+        {
+            markCursor = tail;
+        }
+    }
+
+    const uint8_t *region;
+    size_t slots;
+    size_t head;
+    size_t tail;
+    size_t markCursor;
+    size_t pending;
+    uint32_t nextSequence;
+    uint16_t boot;
+    uint32_t dropped;
+};
+
+#endif
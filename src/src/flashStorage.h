@@ -0,0 +1,123 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  flashStorage.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Raw access to the internal flash of the SAMD21 through the NVM controller. Regions are
+ *        reserved inside the program flash with FLASH_REGION and are read directly as memory.
+ *
+ */
+
+#ifndef FLASHSTORAGE_H
+#define FLASHSTORAGE_H
+
+#include <Arduino.h>
+
+// The SAMD21 writes flash by pages of 64 bytes and erases it by rows of 4 pages
+#define FLASH_PAGE_SIZE 64
+#define FLASH_ROW_SIZE 256
+
+#if defined(PLANTKEEPER_NATIVE)
+
+#include <NativeHAL.h>
+
+// On Linux the region is a memory-mapped file so its content survives a restart of the process
+#define FLASH_REGION(name, size) const uint8_t *const name = nativeHal::flashRegion(#name, size)
+
+inline void flashEraseRow(const volatile void *address)
+{
+    nativeHal::flashErase(address, FLASH_ROW_SIZE);
+}
+
+inline void flashWrite(const volatile void *address, const void *data, size_t size)
+{
+    nativeHal::flashProgram(address, data, size);
+}
+
+#else
+
+// Same trick as the FlashStorage libraries: an aligned constant array, zero-filled by the upload,
+// reserves the space in the program flash
+#define FLASH_REGION(name, size)                                                               \
+    __attribute__((__aligned__(FLASH_ROW_SIZE), used)) static const uint8_t name##Storage[size] = {}; \
+    const uint8_t *const name = name##Storage
+
+/**
+ * @brief Erases the row containing an address, every byte of it reads 0xFF afterwards (about 6 ms)
+ * @param address Any address inside the row
+ */
+inline void flashEraseRow(const volatile void *address)
+{
+    NVMCTRL->ADDR.reg = ((uint32_t)address & ~(FLASH_ROW_SIZE - 1)) / 2;
+    NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_ER;
+    while (!NVMCTRL->INTFLAG.bit.READY)
+    {
+    }
+}
+
+/**
+ * @brief Programs words of flash (about 2.5 ms per page). Programming can only clear bits, the
+ *        words of a page that are not written keep their content.
+ * @param address Word aligned destination
+ * @param data Data to write
+ * @param size Number of bytes, a multiple of 4
+ */
+inline void flashWrite(const volatile void *address, const void *data, size_t size)
+{
+    volatile uint32_t *destination = (volatile uint32_t *)address;
+    const uint8_t *source = (const uint8_t *)data;
+    size_t words = (size + 3) / 4;
+
+    // Pages are written explicitly once the page buffer holds the new words
+    NVMCTRL->CTRLB.bit.MANW = 1;
+    while (words)
+    {
+        NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_PBC;
+        while (!NVMCTRL->INTFLAG.bit.READY)
+        {
+        }
+        do
+        {
+            uint32_t word;
+            memcpy(&word, source, sizeof(word));
+            *destination++ = word;
+            source += 4;
+            words--;
+        } while (words && ((uint32_t)destination & (FLASH_PAGE_SIZE - 1)));
+
+        NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_WP;
+        while (!NVMCTRL->INTFLAG.bit.READY)
+        {
+        }
+    }
+}
+
+#endif
+
+/**
+ * @brief CRC-32 (IEEE) of a buffer, used to recognise records torn by a power loss
+ */
+inline uint32_t crc32(const void *data, size_t length)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    uint32_t crc = 0xFFFFFFFF;
+    while (length--)
+    {
+        crc ^= *bytes++;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+#endif
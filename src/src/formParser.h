@@ -0,0 +1,246 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  formParser.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Streaming parser of application/x-www-form-urlencoded bodies. The bytes can come in any
+ *        number of pieces; each value is percent-decoded ("+" is a space) straight into the buffer
+ *        of its field, with the length checked, and nothing is allocated. Unknown fields are
+ *        skipped, an invalid escape is kept as text like browsers do.
+ *
+ */
+
+#ifndef FORMPARSER_H
+#define FORMPARSER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Longest field name recognised, longer names are skipped with their value
+#ifndef FORM_MAX_NAME
+#define FORM_MAX_NAME 16
+#endif
+
+/**
+ * @brief A field the parser fills
+ */
+struct FormField
+{
+    const char *name;
+    char *value;     // Decoded value, always terminated; empty when the field is missing
+    size_t size;     // Size of value, terminator included
+    bool found;      // The body had the field, a later occurrence replaces an earlier one
+    bool truncated;  // The value did not fit or held a NUL, what fit is kept
+};
+
+// Describes a field whose value is decoded into a char array
+#define FORM_FIELD(name, buffer) {name, buffer, sizeof(buffer), false, false}
+
+class FormParser
+{
+public:
+    /**
+     * @brief A parser without fields, to be replaced by one built for the fields of a body
+     */
+    FormParser() : FormParser(nullptr, 0) {}
+
+    /**
+     * @param fields The fields to fill, their values are emptied
+     * @param count Number of fields
+     */
+    FormParser(FormField *fields, size_t count)
+        : fields(fields), count(count), inValue(false), nameLength(0), nameTooLong(false), current(nullptr),
+          valueLength(0), escapeLength(0)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            fields[i].value[0] = '\0';
+            fields[i].found = false;
+            fields[i].truncated = false;
+        }
+    }
+
+    void feed(const char *data, size_t length)
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            feed(data[i]);
+        }
+    }
+
+    void feed(char c)
+    {
+        if (escapeLength > 0)
+        {
+            int digit = hexDigit(c);
+            if (digit < 0)
+            {
+                flushEscape();
+            }
+            else if (escapeLength == 1)
+            {
+                escapeText[1] = c;
+                escapeLength = 2;
+                return;
+            }
+            else
+            {
+                escapeLength = 0;
+                emit((char)(hexDigit(escapeText[1]) << 4 | digit));
+                return;
+            }
+        }
+
+        if (c == '&')
+        {
+            endPair();
+        }
+        else if (c == '=' && !inValue)
+        {
+            startValue();
+        }
+        else if (c == '%')
+        {
+            escapeText[0] = c;
+            escapeLength = 1;
+        }
+        else
+        {
+            emit(c == '+' ? ' ' : c);
+        }
+    }
+
+    /**
+     * @brief Ends the body, the last pair has no "&" after it
+     */
+    void finish()
+    {
+        flushEscape();
+        endPair();
+    }
+
+private:
+    static int hexDigit(char c)
+    {
+        if (c >= '0' && c <= '9')
+        {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f')
+        {
+            return c - 'a' + 10;
+        }
+        if (c >= 'A' && c <= 'F')
+        {
+            return c - 'A' + 10;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Writes an incomplete escape as the text it was
+     */
+    void flushEscape()
+    {
+        size_t length = escapeLength;
+        escapeLength = 0;
+        for (size_t i = 0; i < length; i++)
+        {
+            emit(escapeText[i]);
+        }
+    }
+
+    void emit(char c)
+    {
+        if (!inValue)
+        {
+            if (nameLength < FORM_MAX_NAME)
+            {
+                name[nameLength++] = c;
+            }
+            else
+            {
+                nameTooLong = true;
+            }
+            return;
+        }
+        if (!current)
+        {
+            return;
+        }
+        if (c == '\0' || valueLength + 1 >= current->size)
+        {
+            current->truncated = true;
+            return;
+        }
+        current->value[valueLength++] = c;
+        current->value[valueLength] = '\0';
+    }
+
+    void startValue()
+    {
+        inValue = true;
+        current = nullptr;
+        valueLength = 0;
+        for (size_t i = 0; i < count && !nameTooLong; i++)
+        {
+            if (strlen(fields[i].name) == nameLength && memcmp(fields[i].name, name, nameLength) == 0)
+            {
+                current = &fields[i];
+                current->value[0] = '\0';
+                current->found = true;
+                current->truncated = false;
+                return;
+            }
+        }
+    }
+
+    void endPair()
+    {
+        // A name without "=" is a field with an empty value
+        if (!inValue && nameLength > 0)
+        {
+            startValue();
+        }
+        inValue = false;
+        nameLength = 0;
+        nameTooLong = false;
+        current = nullptr;
+    }
+
+    FormField *fields;
+    size_t count;
+    bool inValue;
+    char name[FORM_MAX_NAME];
+    size_t nameLength;
+    bool nameTooLong;
+    FormField *current;
+    size_t valueLength;
+    char escapeText[2];
+    size_t escapeLength;
+};
+
+/**
+ * @brief Parses a complete body
+ * @param body The body, not necessarily terminated
+ * @param length Its length, the Content-Length of the request
+ * @param fields The fields to fill
+ * @param count Number of fields
+ */
+inline void parseForm(const char *body, size_t length, FormField *fields, size_t count)
+{
+    FormParser parser(fields, count);
+    parser.feed(body, length);
+    parser.finish();
+}
+
+#endif
@@ -0,0 +1,466 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  httpServer.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Non-blocking HTTP server. Each loop() iteration reads what is available on every open
+ *        connection and advances its parser, so a slow client never stalls the rest of the loop.
+ *        A form body is decoded into the fields of its route as it arrives (HttpFormRoute), so its
+ *        length is not bound by a body buffer.
+ *
+ */
+
+#ifndef HTTPSERVER_H
+#define HTTPSERVER_H
+
+#include <Arduino.h>
+#include <WiFiNINA.h>
+#include "formParser.h"
+
+// Number of connections parsed in parallel (the NINA module has 10 sockets for everything)
+#ifndef HTTP_MAX_CLIENTS
+#define HTTP_MAX_CLIENTS 4
+#endif
+// Longest request line or header line accepted
+#ifndef HTTP_MAX_LINE
+#define HTTP_MAX_LINE 128
+#endif
+// Limit on the whole header section
+#ifndef HTTP_MAX_HEADER_BYTES
+#define HTTP_MAX_HEADER_BYTES 2048
+#endif
+// Largest request body kept whole in HttpRequest::body
+#ifndef HTTP_MAX_BODY
+#define HTTP_MAX_BODY 256
+#endif
+// Largest form body decoded as it arrives, only its fields are kept. The configuration form takes
+// about 320 bytes with a 32-byte UTF-8 SSID and a 63-character password percent-encoded.
+#ifndef HTTP_MAX_FORM_BODY
+#define HTTP_MAX_FORM_BODY 1024
+#endif
+// A connection that sends nothing for that long is answered with 408 and closed
+#ifndef HTTP_CLIENT_TIMEOUT
+#define HTTP_CLIENT_TIMEOUT 5000
+#endif
+// Bytes read from one connection per poll, bounds the time spent in the server per loop()
+#ifndef HTTP_READ_CHUNK
+#define HTTP_READ_CHUNK 64
+#endif
+
+/**
+ * @brief A fully received request, as handed to the route handler
+ */
+struct HttpRequest
+{
+    char method[8];
+    char path[48];
+    int contentLength;
+    bool acceptsGzip;     // Accept-Encoding lists gzip
+    char ifNoneMatch[40]; // ETags the client has cached, empty when none (or too long to keep)
+    bool formDecoded;     // The body went into the fields given by the form route, body is then empty
+    char body[HTTP_MAX_BODY + 1];
+    size_t bodyLength;
+};
+
+/**
+ * @brief Route handler, writes the complete response to the client. The connection is closed
+ *        by the server once the handler returns, unless the handler called HttpServer::detach().
+ */
+typedef void (*HttpHandler)(WiFiClient &client, const HttpRequest &request);
+
+/**
+ * @brief Form route, called once the headers of a request with a body are received
+ * @param request The request, without its body yet
+ * @param fields Set to the fields the body is decoded into as it arrives
+ * @return Number of fields, 0 to keep the body whole in HttpRequest::body instead
+ */
+typedef size_t (*HttpFormRoute)(const HttpRequest &request, FormField *&fields);
+
+/**
+ * @brief Writes a response without body
+ * @param client The client to answer
+ * @param status The status line, for example "408 Request Timeout"
+ */
+inline void writeHttpStatus(Print &client, const char *status)
+{
+    client.print(F("HTTP/1.1 "));
+    client.print(status);
+    client.print(F("\r\nConnection: close\r\nContent-Length: 0\r\n\r\n"));
+}
+
+class HttpServer
+{
+public:
+    HttpServer(WiFiServer &server, HttpHandler handler, HttpFormRoute formRoute = nullptr)
+        : server(server), handler(handler), formRoute(formRoute), detached(false), formOwner(nullptr)
+    {
+    }
+
+    /**
+     * @brief Accepts new connections and advances every open one, never waits for data
+     */
+    void poll()
+    {
+        WiFiClient incoming = server.available();
+        if (incoming)
+        {
+            attach(incoming);
+        }
+
+        for (int i = 0; i < HTTP_MAX_CLIENTS; i++)
+        {
+            if (connections[i].state != Free)
+            {
+                advance(connections[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Drops every open connection, used before the WiFi mode changes
+     */
+    void closeAll()
+    {
+        for (int i = 0; i < HTTP_MAX_CLIENTS; i++)
+        {
+            if (connections[i].state != Free)
+            {
+                close(connections[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Called by the handler to keep the connection of the request open once it returns, the
+     *        client then belongs to the handler (a stream of events)
+     */
+    void detach()
+    {
+        detached = true;
+    }
+
+    /**
+     * @brief Number of connections currently being parsed
+     */
+    int activeConnections() const
+    {
+        int count = 0;
+        for (int i = 0; i < HTTP_MAX_CLIENTS; i++)
+        {
+            if (connections[i].state != Free)
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
+private:
+    enum State
+    {
+        Free,
+        RequestLine,
+        Headers,
+        Body
+    };
+
+    struct Connection
+    {
+        WiFiClient client;
+        State state = Free;
+        unsigned long lastActivity = 0;
+        char line[HTTP_MAX_LINE];
+        size_t lineLength = 0;
+        size_t headerBytes = 0;
+        HttpRequest request;
+    };
+
+    void attach(WiFiClient &incoming)
+    {
+        // server.available() keeps returning a socket while it has unread data
+        for (int i = 0; i < HTTP_MAX_CLIENTS; i++)
+        {
+            if (connections[i].state != Free && connections[i].client == incoming)
+            {
+                return;
+            }
+        }
+        for (int i = 0; i < HTTP_MAX_CLIENTS; i++)
+        {
+            if (connections[i].state == Free)
+            {
+                Connection &connection = connections[i];
+                connection.client = incoming;
+                connection.state = RequestLine;
+                connection.lastActivity = millis();
+                connection.lineLength = 0;
+                connection.headerBytes = 0;
+                connection.request.method[0] = '\0';
+                connection.request.path[0] = '\0';
+                connection.request.contentLength = 0;
+                connection.request.acceptsGzip = false;
+                connection.request.ifNoneMatch[0] = '\0';
+                connection.request.formDecoded = false;
+                connection.request.bodyLength = 0;
+                connection.request.body[0] = '\0';
+                return;
+            }
+        }
+        writeHttpStatus(incoming, "503 Service Unavailable");
+        incoming.stop();
+    }
+
+    void close(Connection &connection)
+    {
+        connection.client.stop();
+        connection.state = Free;
+        releaseForm(connection);
+    }
+
+    void releaseForm(Connection &connection)
+    {
+        if (formOwner == &connection)
+        {
+            formOwner = nullptr;
+        }
+    }
+
+    /**
+     * @brief Sets up the decoding of the body into the fields of the form route, if it has some.
+     *        One form is decoded at a time, the fields are shared.
+     * @return false when the connection was answered with an error
+     */
+    bool startForm(Connection &connection)
+    {
+        FormField *fields = nullptr;
+        size_t count = formRoute ? formRoute(connection.request, fields) : 0;
+        if (count == 0)
+        {
+            return true;
+        }
+        if (connection.request.contentLength > HTTP_MAX_FORM_BODY)
+        {
+            fail(connection, "413 Payload Too Large");
+            return false;
+        }
+        if (formOwner)
+        {
+            fail(connection, "503 Service Unavailable");
+            return false;
+        }
+        formOwner = &connection;
+        form = FormParser(fields, count);
+        connection.request.formDecoded = true;
+        return true;
+    }
+
+    void fail(Connection &connection, const char *status)
+    {
+        writeHttpStatus(connection.client, status);
+        close(connection);
+    }
+
+    void advance(Connection &connection)
+    {
+        int available = connection.client.available();
+        if (available <= 0)
+        {
+            if (!connection.client.connected())
+            {
+                close(connection);
+            }
+            else if (millis() - connection.lastActivity > HTTP_CLIENT_TIMEOUT)
+            {
+                fail(connection, "408 Request Timeout");
+            }
+            return;
+        }
+
+        uint8_t chunk[HTTP_READ_CHUNK];
+        int n = connection.client.read(chunk, available < HTTP_READ_CHUNK ? available : HTTP_READ_CHUNK);
+        if (n <= 0)
+        {
+            return;
+        }
+        connection.lastActivity = millis();
+
+        for (int i = 0; i < n && connection.state != Free; i++)
+        {
+            if (connection.state == Body)
+            {
+                HttpRequest &request = connection.request;
+                if (request.formDecoded)
+                {
+                    form.feed((char)chunk[i]);
+                }
+                else
+                {
+                    request.body[request.bodyLength] = (char)chunk[i];
+                }
+                if ((int)++request.bodyLength == request.contentLength)
+                {
+                    if (request.formDecoded)
+                    {
+                        form.finish();
+                    }
+                    else
+                    {
+                        request.body[request.bodyLength] = '\0';
+                    }
+                    respond(connection);
+                }
+            }
+            else
+            {
+                consumeHeaderByte(connection, (char)chunk[i]);
+            }
+        }
+    }
+
+    void consumeHeaderByte(Connection &connection, char c)
+    {
+        if (++connection.headerBytes > HTTP_MAX_HEADER_BYTES)
+        {
+            fail(connection, "431 Request Header Fields Too Large");
+            return;
+        }
+        if (c == '\r')
+        {
+            return;
+        }
+        if (c != '\n')
+        {
+            if (connection.lineLength + 1 >= sizeof(connection.line))
+            {
+                fail(connection, connection.state == RequestLine ? "414 URI Too Long" : "431 Request Header Fields Too Large");
+                return;
+            }
+            connection.line[connection.lineLength++] = c;
+            return;
+        }
+
+        connection.line[connection.lineLength] = '\0';
+        size_t length = connection.lineLength;
+        connection.lineLength = 0;
+
+        if (connection.state == RequestLine)
+        {
+            if (length == 0)
+            {
+                // Tolerate empty lines before the request line
+                return;
+            }
+            if (!parseRequestLine(connection.line, connection.request))
+            {
+                fail(connection, "400 Bad Request");
+                return;
+            }
+            connection.state = Headers;
+        }
+        else if (length > 0)
+        {
+            if (startsWithIgnoreCase(connection.line, "Content-Length:"))
+            {
+                connection.request.contentLength = atoi(connection.line + 15);
+            }
+            else if (startsWithIgnoreCase(connection.line, "Accept-Encoding:"))
+            {
+                connection.request.acceptsGzip = strstr(connection.line + 16, "gzip") != nullptr;
+            }
+            else if (startsWithIgnoreCase(connection.line, "If-None-Match:") &&
+                     length - 14 < sizeof(connection.request.ifNoneMatch))
+            {
+                strcpy(connection.request.ifNoneMatch, connection.line + 14);
+            }
+        }
+        else if (connection.request.contentLength < 0)
+        {
+            fail(connection, "413 Payload Too Large");
+        }
+        else if (connection.request.contentLength > 0)
+        {
+            if (!startForm(connection))
+            {
+                return;
+            }
+            if (!connection.request.formDecoded && connection.request.contentLength > HTTP_MAX_BODY)
+            {
+                fail(connection, "413 Payload Too Large");
+                return;
+            }
+            connection.state = Body;
+        }
+        else
+        {
+            respond(connection);
+        }
+    }
+
+    void respond(Connection &connection)
+    {
+        detached = false;
+        handler(connection.client, connection.request);
+        if (detached)
+        {
+            connection.state = Free;
+            releaseForm(connection);
+        }
+        else
+        {
+            close(connection);
+        }
+    }
+
+    static bool parseRequestLine(const char *line, HttpRequest &request)
+    {
+        const char *space = strchr(line, ' ');
+        if (!space || (size_t)(space - line) >= sizeof(request.method))
+        {
+            return false;
+        }
+        memcpy(request.method, line, space - line);
+        request.method[space - line] = '\0';
+
+        const char *path = space + 1;
+        const char *end = strchr(path, ' ');
+        size_t pathLength = end ? (size_t)(end - path) : strlen(path);
+        if (pathLength == 0 || pathLength >= sizeof(request.path))
+        {
+            return false;
+        }
+        memcpy(request.path, path, pathLength);
+        request.path[pathLength] = '\0';
+        return true;
+    }
+
+    static bool startsWithIgnoreCase(const char *text, const char *prefix)
+    {
+        for (; *prefix; text++, prefix++)
+        {
+            if (tolower((unsigned char)*text) != tolower((unsigned char)*prefix))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    WiFiServer &server;
+    HttpHandler handler;
+    HttpFormRoute formRoute;
+    bool detached;
+    Connection connections[HTTP_MAX_CLIENTS];
+    // Connection whose body is being decoded into the fields of the form route
+    Connection *formOwner;
+    FormParser form;
+};
+
+#endif
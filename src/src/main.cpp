@@ -20,34 +20,87 @@
 #include <WiFiNINA.h>
 #include <ArduinoHttpServer.h>
 #include <ArduinoHttpClient.h>
-#include <vector>
 #include "arduino_secrets.h"
 #include "webpages.h"
-#include "DHT.h"
+#include "httpServer.h"
+#include "eventStream.h"
+#include "formParser.h"
+#include "uplink.h"
+#include "sampleBuffer.h"
+#include "sampleWindow.h"
+#include "reportFilter.h"
+#include "clockSync.h"
+#include "flashLog.h"
+#include "configStore.h"
+#include "telemetry.h"
+#include "scheduler.h"
+#include "wifiLink.h"
+#include "networkScanner.h"
+#include "metrics.h"
+#include "fixedPoint.h"
+#include <ArduinoLowPower.h>
 #include "ArduinoJson.h"
-#include "SI114X.h"
 
 // Function prototypes
-void listNetworks(std::vector<const char *> &networks);
 void startAccessPoint();
-void handleConfigRequest();
-void connectToWiFi();
-void printWEB();
-void readSensors();
+void openAccessPoint();
+void handleHttpRequest(WiFiClient &client, const HttpRequest &request);
+void handleConfigRequest(WiFiClient &client, const HttpRequest &request);
+size_t routeForm(const HttpRequest &request, FormField *&fields);
+void connectToWiFi(bool knownCredentials = false);
+bool loadStoredConfig();
+void onWiFiConnected();
+void onWiFiRejected();
+void printWEB(WiFiClient &client, const HttpRequest &request);
+bool readSensors();
 void printWifiStatus();
+void seedRandom();
 void sendSensorData();
+void recordSample();
+void serveWeb();
+void readTask();
+void pollSensors();
+void publishReading();
+void sampleTask();
+void uplinkTask();
+void ledTask();
+void wifiTask();
+void reportTask();
+void writeMetrics(Print &out);
+void writeReadingsJson(Print &out);
+unsigned long uptime();
+void radioSleep();
+void lowPowerSleep();
+void persistSamples();
+LoggedSample toLoggedSample(const sensorSample &sample);
+template <typename TTarget>
+void setJsonReading(TTarget target, const SensorField &field, int16_t value);
+void writeSampleJson(JsonObject item, const LoggedSample &record, bool annotate, unsigned long now, ServerView *view);
+size_t serializeSamples(const LoggedSample *samples, size_t count, bool annotate, char *buffer, size_t size,
+                        ServerView *view);
+void benchmarkSensors();
 
 // Global variables
-char ssid[32];
+// Up to 32 bytes for an SSID and 63 characters for a WPA passphrase, with the terminator
+char ssid[33];
 char pass[64];
+// Fields of the configuration form, decoded as the body arrives and copied once the form is valid
+char formSsid[sizeof(ssid)];
+char formPass[sizeof(pass)];
+char formSensorId[8];
+FormField configFields[] = {FORM_FIELD("ssid", formSsid), FORM_FIELD("pass", formPass),
+                            FORM_FIELD("idsensor", formSensorId)};
+const size_t configFieldCount = sizeof(configFields) / sizeof(configFields[0]);
 bool needsWiFiConfig = true;
 bool connectedToWiFi = false;
 bool incorrectPassword = false;
 bool APMode = false;
-const int dry = 1023;
-const int wet = 700;
-const int minLight = 160;
-const int maxLight = 800;
+// The access point opens once the network scan started by startAccessPoint() is collected
+bool accessPointPending = false;
+// Actions requested by a web client, run from loop() once the response has been sent
+bool configSubmitted = false;
+bool reconfigureRequested = false;
+unsigned long configSubmittedMillis = 0;
 
 // Constants for the access point mode
 const char *ssidArduino = SECRET_SSID;
@@ -55,30 +108,164 @@ const char *passArduino = SECRET_PASS;
 
 int status = WL_IDLE_STATUS;
 
-unsigned long previousMillis = 0;
-// 10 seconds interval for the data to be sent
-const long interval = 10000;
+// Duty cycling for boards on battery: between two tasks the SAMD21 deep sleeps and the WiFi module is
+// powered down. The web page is only reachable during the maintenance window that follows a reset
+// or the WiFi configuration, each page view extends it.
+#ifndef LOW_POWER_MODE
+#define LOW_POWER_MODE 0
+#endif
+#ifndef MAINTENANCE_WINDOW
+#define MAINTENANCE_WINDOW 300000
+#endif
 
-unsigned long previousMillisLed = 0;
+// Interval for the data to be sent: 10 seconds, 5 minutes in low power mode
+#ifndef UPLOAD_INTERVAL
+#define UPLOAD_INTERVAL (LOW_POWER_MODE ? 300000 : 10000)
+#endif
+const long interval = UPLOAD_INTERVAL;
+// Interval between two readings of the sensors, aggregated until the next sample is sent. The DHT11
+// cannot be read more than once per second.
+#ifndef SENSOR_READ_INTERVAL
+#define SENSOR_READ_INTERVAL (LOW_POWER_MODE ? 30000 : 2000)
+#endif
 // 1 seconds interval for led to blink
 const long intervalLed = 1000;
+// Times the sensor pipeline and the serialization at boot, see benchmarkSensors()
+#ifndef SENSOR_BENCHMARK
+#define SENSOR_BENCHMARK 0
+#endif
+#ifndef SENSOR_BENCHMARK_RUNS
+#define SENSOR_BENCHMARK_RUNS 500
+#endif
+// Interval between two prints of the task statistics
+#ifndef SCHEDULER_REPORT_INTERVAL
+#define SCHEDULER_REPORT_INTERVAL 60000
+#endif
+
+// Jobs of loop(), see setup() for their periods
+Scheduler<8> scheduler;
+// Set by the sampling task, the upload happens on the next pass of the uplink task
+bool uploadDue = false;
+
+// Number of samples sent in one POST to /sensor-data. With 1 every sample is posted on its own as a
+// JSON object, above that the body is a JSON array and each element carries its age in ms.
+#ifndef UPLOAD_BATCH_SIZE
+#define UPLOAD_BATCH_SIZE 1
+#endif
+// Samples kept while the server cannot be reached, the oldest are dropped beyond that
+#ifndef SAMPLE_BUFFER_CAPACITY
+#define SAMPLE_BUFFER_CAPACITY 64
+#endif
+// Encoding of the upload body: UPLOAD_FORMAT_JSON, or UPLOAD_FORMAT_BINARY for the fixed layout of
+// telemetry.h (36 bytes per sample of the standard kit instead of about 175)
+#ifndef UPLOAD_FORMAT
+#define UPLOAD_FORMAT UPLOAD_FORMAT_JSON
+#endif
+// 1 only records a sample when a reading moved out of the deadband of its field since the last
+// one, or after REPORT_HEARTBEAT ms without a sample; the readings in between go into the next sample
+#ifndef REPORT_ON_CHANGE
+#define REPORT_ON_CHANGE 0
+#endif
+#ifndef REPORT_HEARTBEAT
+#define REPORT_HEARTBEAT (LOW_POWER_MODE ? 3600000 : 300000)
+#endif
+// 1 leaves out of the JSON samples the fields within their deadband of the last value the server
+// acknowledged (the first sample after boot is complete)
+#ifndef REPORT_DELTA
+#define REPORT_DELTA 0
+#endif
+// Room for one serialized sample in the upload body
+const size_t sampleJsonSize = 96 + 48 * SENSOR_FIELD_COUNT;
+
+RingBuffer<sensorSample, SAMPLE_BUFFER_CAPACITY> pendingSamples;
+// Readings taken since the last sample
+SampleWindow sampleWindow;
+ReportFilter reportFilter(REPORT_HEARTBEAT);
+// Fields of the last acknowledged samples, for REPORT_DELTA
+ServerView serverView;
+char uploadBody[UPLOAD_BATCH_SIZE * sampleJsonSize];
+// Set after a successful upload while full batches are still waiting, to drain the backlog
+bool drainPending = false;
+
+// Flash rows (256 bytes, 4 samples each) of the offline log, 32 KB of the 256 KB flash by default
+#ifndef FLASH_LOG_ROWS
+#define FLASH_LOG_ROWS 128
+#endif
+// Buffered samples beyond which the oldest are moved to flash even with WiFi up (server unreachable)
+const size_t persistThreshold = 2 * UPLOAD_BATCH_SIZE;
+FLASH_REGION(sampleLogArea, FLASH_LOG_ROWS * FLASH_ROW_SIZE);
+FlashLog sampleLog(sampleLogArea, FLASH_LOG_ROWS);
+// WiFi credentials and sensor id, saved once they connected so a power cycle skips the access point
+FLASH_REGION(configArea, CONFIG_STORE_ROWS * FLASH_ROW_SIZE);
+ConfigStore configStore(configArea);
+bool configStored = false;
+// Push button to ground: held during a reset, the board starts the access point even with a stored configuration
+#ifndef CONFIG_BUTTON_PIN
+#define CONFIG_BUTTON_PIN 5
+#endif
+// Uptime of the first accepted upload, 0 until then
+unsigned long firstUploadMs = 0;
+// Unix time of the samples, read from the WiFi module while connected
+ClockSync wallClock;
+
+// Low power mode state. millis() stops during deep sleep, uptime() adds the time slept.
+unsigned long sleptMs = 0;
+unsigned long wokeAt = 0;
+unsigned long maintenanceUntil = 0;
+
+/**
+ * @brief Awake time of the duty cycles since boot
+ */
+struct DutyCycleStats
+{
+    uint32_t cycles;
+    unsigned long lastAwakeMs;
+    unsigned long maxAwakeMs;
+    uint64_t totalAwakeMs;
+    uint64_t totalSleptMs;
+};
+DutyCycleStats dutyCycle = {};
+
+// Runtime metrics served on /metrics, bucket bounds in the unit of each histogram
+const uint32_t loopBuckets[] = {100, 1000, 10000, 100000, 1000000};             // us
+const uint32_t sensorReadBuckets[] = {1000, 5000, 10000, 25000, 50000, 100000}; // us
+const uint32_t uploadBuckets[] = {50, 100, 250, 500, 1000, 2500, 5000, 10000};  // ms
+Histogram<5> loopTime(loopBuckets);
+Histogram<6> sensorReadTime(sensorReadBuckets);
+Histogram<8> uploadLatency(uploadBuckets);
+StatusCounter uploadStatus;
+uint32_t webRequests = 0;
+
+// Last reading of the sensors, served by /api/v1/readings: its number since boot and uptime()
+uint32_t readingSequence = 0;
+unsigned long lastReadingAt = 0;
 
 // Instantiation of objects
-std::vector<const char *> networks;
+NetworkScanner networks;
 sensorData sensorDatas;
 WiFiServer server(80);
-WiFiClient client;
-DHT dht(2, DHT11);
+HttpServer webServer(server, handleHttpRequest, routeForm);
+// Live readings for the data page, on /events
+EventStream events;
+WiFiClient uplinkClient;
+WiFiLink wifiLink;
+ActiveSensorKit sensors;
 JsonDocument doc;
-SI114X SI1145 = SI114X();
 
 //--------------------------------------------IMPORTANT--------------------------------------------
-// SERVER'S ADRESS IP NEEDS TO BE ADDED HERE
-IPAddress serverAddress();
-// SERVER'S PORT NEEDS TO BE ADDED HERE
-int port = ;
+// SERVER'S ADRESS IP NEEDS TO BE ADDED HERE (or passed with -D SERVER_IP=a,b,c,d in platformio.ini)
+#ifndef SERVER_IP
+#define SERVER_IP 0, 0, 0, 0
+#endif
+// SERVER'S PORT NEEDS TO BE ADDED HERE (or passed with -D SERVER_PORT=port in platformio.ini)
+#ifndef SERVER_PORT
+#define SERVER_PORT 80
+#endif
+IPAddress serverAddress(SERVER_IP);
+int port = SERVER_PORT;
 
-HttpClient httpClient(client, serverAddress, port);
+HttpClient httpClient(uplinkClient, serverAddress, port);
+Uplink uplink(uplinkClient, httpClient);
 //--------------------------------------------------------------------------------------------------
 
 // Arduino's Ip should be always the same, it might change but the arduino usually has the same IP in access point mode
@@ -90,85 +277,416 @@ String ipWifi = "";
 void setup()
 {
     Serial.begin(9600);
-    dht.begin();
-    while (!SI1145.Begin())
+    sensors.begin();
+#if SENSOR_BENCHMARK
+    benchmarkSensors();
+#endif
+    pinMode(LED_BUILTIN, OUTPUT);
+    pinMode(CONFIG_BUTTON_PIN, INPUT_PULLUP);
+    uplink.begin();
+    sampleLog.begin();
+    // At most an erase and a write, the samples of the boot need its number
+    while (!sampleLog.recordBoot())
     {
-        Serial.println("Si1145 is not ready!");
-        delay(1000);
     }
-    pinMode(LED_BUILTIN, OUTPUT);
+    Serial.print("Boot ");
+    Serial.println(sampleLog.bootNumber());
+    Serial.print("Samples waiting in flash: ");
+    Serial.println(sampleLog.pendingCount());
+    seedRandom();
 
-    listNetworks(networks);
-    startAccessPoint();
+    if (digitalRead(CONFIG_BUTTON_PIN) == LOW)
+    {
+        Serial.println("Configuration button held");
+        startAccessPoint();
+    }
+    else if (loadStoredConfig())
+    {
+        connectToWiFi(true);
+    }
+    else
+    {
+        startAccessPoint();
+    }
+
+    // Budgets are the longest a run should block the others; the uplink allows for one HTTP exchange
+    scheduler.add("web", serveWeb, 0, 5000);
+    scheduler.add("capture", pollSensors, 0, 500);
+    scheduler.add("uplink", uplinkTask, 0, 100000);
+    scheduler.add("wifi", wifiTask, 0, 5000);
+#if !LOW_POWER_MODE
+    // In low power mode the LED stays off
+    scheduler.add("led", ledTask, intervalLed, 1000);
+#endif
+    scheduler.add("sensors", readTask, SENSOR_READ_INTERVAL, 50000);
+    scheduler.add("sample", sampleTask, interval, 5000);
+    scheduler.add("report", reportTask, SCHEDULER_REPORT_INTERVAL, 20000);
 }
 
 void loop()
 {
+    unsigned long start = micros();
+    scheduler.tick();
+    loopTime.observe(micros() - start);
+#if LOW_POWER_MODE
+    lowPowerSleep();
+#endif
+}
+
+//--------------------------------------------TASKS--------------------------------------------
+
+/**
+ * @brief Serve the web clients, and run the actions they requested once their response is sent
+ */
+void serveWeb()
+{
+    webServer.poll();
+    events.poll();
+
+    // Leave the browser a second to receive the connecting page before the access point goes down
+    if (configSubmitted && millis() - configSubmittedMillis >= 1000)
+    {
+        configSubmitted = false;
+        webServer.closeAll();
+        events.closeAll();
+        connectToWiFi();
+    }
+    if (reconfigureRequested)
+    {
+        reconfigureRequested = false;
+        webServer.closeAll();
+        events.closeAll();
+        startAccessPoint();
+    }
+}
+
+/**
+ * @brief Read the sensors, the web page shows the last reading
+ */
+void readTask()
+{
+    unsigned long start = micros();
+    bool ready = readSensors();
+    sensorReadTime.observe(micros() - start);
+    if (!ready)
+    {
+        // A sensor read in the background has no value yet, an incomplete reading is not recorded
+        return;
+    }
+    readingSequence++;
+    lastReadingAt = uptime();
+    sampleWindow.add(sensorDatas);
+    reportFilter.observe(sensorDatas.values);
+    publishReading();
+}
+
+/**
+ * @brief Send the new reading to the open event streams, formatted once for all of them
+ */
+void publishReading()
+{
+    char data[EVENT_STREAM_MESSAGE - 32];
+    if (events.size() > 0 && formatReadingEvent(data, sizeof(data), sensorDatas, readingSequence))
+    {
+        events.publish("reading", data);
+    }
+}
 
+/**
+ * @brief Let the sensors that are read in the background progress (DHT_CAPTURE)
+ */
+void pollSensors()
+{
+    sensors.poll();
+}
+
+/**
+ * @brief Record a sample, as soon as the board is configured and even while the server is unreachable.
+ *        With REPORT_ON_CHANGE the window stays open while the readings do not change.
+ */
+void sampleTask()
+{
     if (needsWiFiConfig)
     {
-        client = server.available();
-        if (client)
+        sampleWindow.reset();
+    }
+    else if (!sampleWindow.empty() && (!REPORT_ON_CHANGE || reportFilter.due(uptime())))
+    {
+        recordSample();
+        uploadDue = true;
+#if LOW_POWER_MODE
+        // Power the WiFi module up for the upload, with the address of the last DHCP lease
+        if (wifiLink.state() == WIFI_LINK_STOPPED || wifiLink.state() == WIFI_LINK_BACKOFF)
         {
-            handleConfigRequest();
+            wifiLink.reconnect();
         }
+#endif
+    }
+}
+
+/**
+ * @brief Upload the new sample or the next batch of the backlog, otherwise move samples to flash.
+ *        At most one upload or one flash operation per run so the web server is never held long.
+ */
+void uplinkTask()
+{
+    if (connectedToWiFi && (uploadDue || drainPending))
+    {
+        uploadDue = false;
+        sendSensorData();
     }
     else
     {
-        client = server.available();
-        if (client)
+        // An upload waiting for the connection being set up is sent as soon as the link is up
+        if (wifiLink.state() != WIFI_LINK_CONNECTING)
         {
-            printWEB();
+            uploadDue = false;
         }
+        persistSamples();
     }
+}
 
+/**
+ * @brief Blink the LED while connected to the WiFi
+ */
+void ledTask()
+{
     if (connectedToWiFi)
     {
-        unsigned long currentMillis = millis();
-        if (currentMillis - previousMillis >= interval)
-        {
-            previousMillis = currentMillis;
-            sendSensorData();
-        }
-        if (currentMillis - previousMillisLed >= intervalLed)
-        {
-            previousMillisLed = currentMillis;
-            digitalWrite(LED_BUILTIN, !digitalRead(LED_BUILTIN));
-        }
+        digitalWrite(LED_BUILTIN, !digitalRead(LED_BUILTIN));
     }
+}
 
-    if((WiFi.status() != WL_CONNECTED) && !APMode)
+/**
+ * @brief Follow the WiFi link, which reconnects by itself when the connection is lost, and collect
+ *        the results of a network scan before opening the access point
+ */
+void wifiTask()
+{
+    switch (wifiLink.poll())
     {
+    case WIFI_LINK_UP:
+        onWiFiConnected();
+        break;
+    case WIFI_LINK_LOST:
+        // Sampling goes on, the samples wait in the buffer and the flash log
+        Serial.println("WiFi connection lost, reconnecting...");
         connectedToWiFi = false;
-        connectToWiFi();
+        uplink.stop();
+        break;
+    case WIFI_LINK_REJECTED:
+        onWiFiRejected();
+        break;
+    default:
+        break;
+    }
+
+    if (networks.poll())
+    {
+        Serial.print("Found ");
+        Serial.print((unsigned long)networks.size());
+        Serial.print(" networks in ");
+        Serial.print(networks.lastScanMs());
+        Serial.println(" ms");
+    }
+    // The scan gave its results or was given up
+    if (accessPointPending && !networks.isScanning())
+    {
+        openAccessPoint();
     }
 }
 
-//--------------------------------------------WEB SERVER FUNCTIONS--------------------------------------------
+/**
+ * @brief Print the timing statistics of the tasks
+ */
+void reportTask()
+{
+    scheduler.printStats(Serial);
+    sensors.printStats(Serial);
+
+    const WiFiLinkStats &wifi = wifiLink.getStats();
+    Serial.print("WiFi: connections ");
+    Serial.print(wifi.connections);
+    Serial.print(", losses ");
+    Serial.print(wifi.losses);
+    Serial.print(", attempts ");
+    Serial.print(wifi.attempts);
+    Serial.print(" (");
+    Serial.print(wifi.failedAttempts);
+    Serial.print(" failed), time to connect last/max/mean ");
+    Serial.print(wifi.lastReconnectMs);
+    Serial.print("/");
+    Serial.print(wifi.maxReconnectMs);
+    Serial.print("/");
+    Serial.print(wifi.connections ? (unsigned long)(wifi.totalReconnectMs / wifi.connections) : 0UL);
+    Serial.println(" ms");
+#if REPORT_ON_CHANGE
+    Serial.print("Sampling periods without change: ");
+    Serial.println(reportFilter.suppressedCount());
+#endif
+#if LOW_POWER_MODE
+    Serial.print("Duty cycles: ");
+    Serial.print(dutyCycle.cycles);
+    Serial.print(", max awake ");
+    Serial.print(dutyCycle.maxAwakeMs);
+    Serial.print(" ms, mean awake ");
+    Serial.print(dutyCycle.cycles ? (unsigned long)(dutyCycle.totalAwakeMs / dutyCycle.cycles) : 0UL);
+    Serial.print(" ms, awake ");
+    Serial.print((unsigned long)(dutyCycle.totalAwakeMs * 1000 / (dutyCycle.totalAwakeMs + dutyCycle.totalSleptMs + 1)));
+    Serial.println(" per mille");
+#endif
+}
+
+/**
+ * @brief Write the runtime metrics in the Prometheus text format, scraped on /metrics
+ * @param out Where the response is written, usually a PageWriter around the client
+ */
+void writeMetrics(Print &out)
+{
+    out.print(F("HTTP/1.1 200 OK\r\n"
+                "Content-Type: text/plain; version=0.0.4\r\n"
+                "Connection: close\r\n"
+                "\r\n"));
+
+    writeMetric(out, "plantkeeper_uptime_seconds", "gauge", "Time since boot, deep sleep included", uptime() / 1000);
+    writeMetric(out, "plantkeeper_boot", "gauge", "Number of the boot, counted in the flash log", sampleLog.bootNumber());
+    writeMetric(out, "plantkeeper_free_memory_bytes", "gauge", "Free RAM between the heap and the stack", freeMemory());
+    loopTime.write(out, "plantkeeper_loop_duration_us", "Duration of the loop() iterations");
+    sensorReadTime.write(out, "plantkeeper_sensor_read_duration_us", "Duration of a reading of all the sensors");
+
+    char labels[40];
+    writeMetricHeader(out, "plantkeeper_task_runs_total", "counter", "Runs of the task");
+    for (size_t i = 0; i < scheduler.size(); i++)
+    {
+        snprintf(labels, sizeof(labels), "task=\"%s\"", scheduler.task(i).name);
+        writeMetricValue(out, "plantkeeper_task_runs_total", labels, scheduler.task(i).stats.runs);
+    }
+    writeMetricHeader(out, "plantkeeper_task_overruns_total", "counter", "Runs longer than the budget of the task");
+    for (size_t i = 0; i < scheduler.size(); i++)
+    {
+        snprintf(labels, sizeof(labels), "task=\"%s\"", scheduler.task(i).name);
+        writeMetricValue(out, "plantkeeper_task_overruns_total", labels, scheduler.task(i).stats.overruns);
+    }
+    writeMetricHeader(out, "plantkeeper_task_max_duration_us", "gauge", "Longest run of the task");
+    for (size_t i = 0; i < scheduler.size(); i++)
+    {
+        snprintf(labels, sizeof(labels), "task=\"%s\"", scheduler.task(i).name);
+        writeMetricValue(out, "plantkeeper_task_max_duration_us", labels, scheduler.task(i).stats.maxDurationUs);
+    }
+
+    const UplinkStats &uplinkStats = uplink.getStats();
+    uploadStatus.write(out, "plantkeeper_uploads_total", "Uploads to the server by HTTP status class");
+    uploadLatency.write(out, "plantkeeper_upload_latency_ms", "Duration of an upload, retry included");
+    writeMetricHeader(out, "plantkeeper_upload_connections_total", "counter", "Uploads by connection used");
+    writeMetricValue(out, "plantkeeper_upload_connections_total", "reused=\"true\"", uplinkStats.reusedConnections);
+    writeMetricValue(out, "plantkeeper_upload_connections_total", "reused=\"false\"", uplinkStats.newConnections);
+    writeMetric(out, "plantkeeper_samples_suppressed_total", "counter", "Sampling periods without change, not reported",
+                reportFilter.suppressedCount());
+    writeMetric(out, "plantkeeper_clock_drift_ppm", "gauge", "Estimated drift of the board clock, corrected in the sample times",
+                wallClock.drift());
+    writeMetric(out, "plantkeeper_clock_sync_error_ms", "gauge", "Last reading of the WiFi module time minus its prediction",
+                wallClock.lastSyncError());
+    writeMetric(out, "plantkeeper_clock_syncs_total", "counter", "Readings of the WiFi module time", wallClock.syncCount());
+    writeMetric(out, "plantkeeper_clock_steps_total", "counter", "Readings too far from the prediction, taken as they were",
+                wallClock.stepCount());
+    writeMetric(out, "plantkeeper_first_upload_ms", "gauge", "Uptime of the first accepted upload, 0 before", firstUploadMs);
+    writeMetricHeader(out, "plantkeeper_samples_pending", "gauge", "Samples waiting to be uploaded");
+    writeMetricValue(out, "plantkeeper_samples_pending", "store=\"ram\"", pendingSamples.size());
+    writeMetricValue(out, "plantkeeper_samples_pending", "store=\"flash\"", sampleLog.pendingCount());
+    writeMetricHeader(out, "plantkeeper_samples_dropped_total", "counter", "Samples lost because the store was full");
+    writeMetricValue(out, "plantkeeper_samples_dropped_total", "store=\"ram\"", pendingSamples.droppedCount());
+    writeMetricValue(out, "plantkeeper_samples_dropped_total", "store=\"flash\"", sampleLog.droppedCount());
+
+    const WiFiLinkStats &wifi = wifiLink.getStats();
+    writeMetric(out, "plantkeeper_wifi_connections_total", "counter", "Connections to the WiFi network", wifi.connections);
+    writeMetric(out, "plantkeeper_wifi_losses_total", "counter", "Connections lost", wifi.losses);
+    writeMetric(out, "plantkeeper_wifi_attempts_total", "counter", "Association attempts", wifi.attempts);
+    writeMetric(out, "plantkeeper_wifi_failed_attempts_total", "counter", "Association attempts that failed", wifi.failedAttempts);
+    writeMetric(out, "plantkeeper_wifi_reconnect_max_ms", "gauge", "Longest time to (re)connect", wifi.maxReconnectMs);
+    writeMetric(out, "plantkeeper_wifi_rssi_dbm", "gauge", "Signal of the network, 0 when not connected",
+                connectedToWiFi ? WiFi.RSSI() : 0);
+    writeMetric(out, "plantkeeper_http_requests_total", "counter", "Requests served by the web server", webRequests);
+    writeMetric(out, "plantkeeper_event_streams", "gauge", "Open /events streams", events.size());
+    writeMetric(out, "plantkeeper_events_total", "counter", "Reading events sent to the streams", events.sentCount());
+    writeMetric(out, "plantkeeper_event_streams_dropped_total", "counter", "Streams closed by the client or too slow",
+                events.droppedCount());
+#if LOW_POWER_MODE
+    writeMetric(out, "plantkeeper_duty_cycles_total", "counter", "Deep sleep cycles", dutyCycle.cycles);
+    writeMetric(out, "plantkeeper_awake_ms_total", "counter", "Time spent awake between two deep sleeps", dutyCycle.totalAwakeMs);
+    writeMetric(out, "plantkeeper_asleep_ms_total", "counter", "Time spent in deep sleep", dutyCycle.totalSleptMs);
+#endif
+}
+
+//--------------------------------------------LOW POWER--------------------------------------------
 
 /**
- * @brief List the nearby networks
- * @param network Vector to store the networks
- **/
-void listNetworks(std::vector<const char *> &network)
+ * @brief Milliseconds since boot, counting the time spent in deep sleep
+ */
+unsigned long uptime()
 {
-    // scan for nearby networks:
-    Serial.println("Scanning for networks...");
+    return millis() + sleptMs;
+}
 
-    int numSsid = WiFi.scanNetworks();
-    if (numSsid == -1)
+/**
+ * @brief Close the connections and power the WiFi module down
+ */
+void radioSleep()
+{
+    webServer.closeAll();
+    events.closeAll();
+    uplink.stop();
+    wifiLink.stop();
+    connectedToWiFi = false;
+    digitalWrite(LED_BUILTIN, LOW);
+}
+
+/**
+ * @brief Deep sleep until the next periodic task, unless there is work in progress or the
+ *        maintenance window is open
+ */
+void lowPowerSleep()
+{
+    if (needsWiFiConfig || APMode || configSubmitted || uploadDue || drainPending ||
+        wifiLink.state() == WIFI_LINK_CONNECTING || sensors.busy() || (long)(maintenanceUntil - millis()) > 0)
+    {
+        return;
+    }
+    unsigned long sleepMs = scheduler.msUntilNextRun();
+    if (sleepMs == 0 || sleepMs == ULONG_MAX)
     {
-        Serial.println("Couldn't get a WiFi connection");
-        network.push_back("No networks found");
         return;
     }
 
-    for (int thisNet = 0; thisNet < numSsid; thisNet++)
+    if (wifiLink.state() != WIFI_LINK_STOPPED)
     {
-        network.push_back(WiFi.SSID(thisNet));
+        radioSleep();
     }
+    unsigned long awake = millis() - wokeAt;
+    dutyCycle.cycles++;
+    dutyCycle.lastAwakeMs = awake;
+    dutyCycle.totalAwakeMs += awake;
+    dutyCycle.totalSleptMs += sleepMs;
+    if (awake > dutyCycle.maxAwakeMs)
+    {
+        dutyCycle.maxAwakeMs = awake;
+    }
+    Serial.print("Awake ");
+    Serial.print(awake);
+    Serial.print(" ms, sleeping ");
+    Serial.print(sleepMs);
+    Serial.println(" ms");
+    Serial.flush();
+
+    LowPower.deepSleep((int)sleepMs);
+    sleptMs += sleepMs;
+    scheduler.advance(sleepMs);
+    sensors.advance(sleepMs);
+    wifiLink.advance(sleepMs);
+    wokeAt = millis();
 }
 
+//--------------------------------------------WEB SERVER FUNCTIONS--------------------------------------------
+
 /**
  * @brief Start the Arduino in Access Point mode
  */
@@ -177,7 +695,8 @@ void startAccessPoint()
     APMode = true;
     digitalWrite(LED_BUILTIN, HIGH);
     Serial.println("Starting Access Point...");
-    WiFi.end();
+    uplink.stop();
+    wifiLink.stop();
 
     if (WiFi.status() == WL_NO_MODULE)
     {
@@ -185,6 +704,23 @@ void startAccessPoint()
         return;
     }
 
+    // The NINA module only scans in station mode, and a scan would drop the clients of the access
+    // point: the list of the configuration page is collected first by wifiTask()
+    if (networks.start())
+    {
+        accessPointPending = true;
+        return;
+    }
+    Serial.println("Network scan failed");
+    openAccessPoint();
+}
+
+/**
+ * @brief Open the access point and its web server, once the network scan is over
+ */
+void openAccessPoint()
+{
+    accessPointPending = false;
     status = WiFi.beginAP(ssidArduino, passArduino);
 
     if (status != WL_AP_LISTENING)
@@ -202,268 +738,610 @@ void startAccessPoint()
 }
 
 /**
- * @brief Handle the configuration request and extract SSID and Password
+ * @brief Route a complete request received by the web server
+ * @param client The client to answer
+ * @param request The parsed request
  */
-void handleConfigRequest()
+void handleHttpRequest(WiFiClient &client, const HttpRequest &request)
 {
-    Serial.println("Handling Config Request...");
-    String header = "";
-    String ssidParam = "";
-    String passParam = "";
-    String sensorParam = "";
-
-    while (client.connected())
+    webRequests++;
+    // Polling by scripts does not extend the maintenance window, a board on battery goes back to sleep
+    if (strcmp(request.method, "GET") == 0 && strcmp(request.path, "/metrics") == 0)
+    {
+        PageWriter page(client);
+        writeMetrics(page);
+        page.flush();
+        return;
+    }
+    if (strcmp(request.method, "GET") == 0 && strcmp(request.path, "/api/v1/readings") == 0)
+    {
+        PageWriter page(client);
+        writeReadingsJson(page);
+        page.flush();
+        return;
+    }
+    // The stream stays open after the handler, new readings are written to it by publishReading()
+    if (strcmp(request.method, "GET") == 0 && strcmp(request.path, "/events") == 0)
     {
-        if (client.available())
+        if (events.subscribe(client))
+        {
+            webServer.detach();
+        }
+        else
         {
-            char c = client.read();
-            if (c == '\n')
-            {
-                if (header.length() == 0)
-                {
-                    client.println("HTTP/1.1 200 OK");
-                    client.println("Content-type:text/html");
-                    client.println("Connection: close");
-                    client.println();
-                    client.println(generateConfigPage(networks, incorrectPassword));
-                    client.println();
-                    break;
-                }
-                else if (header.indexOf("POST /submit") >= 0)
-                {
-                    String postBody = "";
-                    while (client.available())
-                    {
-                        postBody += (char)client.read();
-                    }
-
-                    // Extract SSID and password from the POST body
-                    int ssidIndex = postBody.indexOf("ssid=") + 5;
-                    int passIndex = postBody.indexOf("pass=") + 5;
-                    int idIndex = postBody.indexOf("idsensor=") + 9;
-                    ssidParam = postBody.substring(ssidIndex, postBody.indexOf('&', ssidIndex));
-                    passParam = postBody.substring(passIndex, postBody.indexOf('&', passIndex)); // Assuming password is the last field
-                    sensorParam = postBody.substring(idIndex);
-
-                    ssidParam.toCharArray(ssid, 32);
-                    passParam.toCharArray(pass, 64);
-                    sensorDatas.sensorId = sensorParam.toInt();
-                    Serial.println("SSID is : ");
-                    Serial.println(ssid);
-                    Serial.println("Password is : ");
-                    Serial.println(pass);
-                    Serial.println("SensorId is : ");
-                    Serial.println(sensorDatas.sensorId);
-
-                    client.println("HTTP/1.1 200 OK");
-                    client.println("Content-type:text/html");
-                    client.println("Connection: close");
-                    client.println();
-                    client.println(generateConnectingPage(ipWifi));
-                    client.println();
-                    delay(1000);
-
-                    break;
-                }
-                else
-                {
-                    header = "";
-                }
-            }
-            else if (c != '\r')
-            {
-                header += c;
-            }
+            writeHttpStatus(client, "503 Service Unavailable");
         }
+        return;
     }
-    if (ssidParam.length() > 0 && passParam.length() > 0 && sensorParam.length() > 0)
+    // Stylesheet and script of the pages, in both modes, the page that links them extended the window
+    const WebAsset *asset = strcmp(request.method, "GET") == 0 ? findWebAsset(request.path) : nullptr;
+    if (asset)
     {
-        needsWiFiConfig = false;
-        APMode = false;
-        connectToWiFi();
+        PageWriter page(client);
+        writeWebAsset(page, *asset, request);
+        page.flush();
+        return;
+    }
+    maintenanceUntil = millis() + MAINTENANCE_WINDOW;
+    if (needsWiFiConfig)
+    {
+        handleConfigRequest(client, request);
+    }
+    else
+    {
+        printWEB(client, request);
     }
-    client.flush();
-    client.stop();
 }
 
 /**
- * @brief Function to connect to the Wi-Fi network using the credentials provided by the user.
+ * @brief Form route of the web server: the body of the configuration form is decoded into
+ *        configFields as it arrives, the other bodies are kept whole
  */
-void connectToWiFi()
+size_t routeForm(const HttpRequest &request, FormField *&fields)
 {
-    // The counter is to make sure we cannot connect to the wifi since sometimes
-    // the connection is not established the first time but the second time it works
-    int counter = 0;
-    WiFi.end();
+    if (!needsWiFiConfig || strcmp(request.method, "POST") != 0 || strcmp(request.path, "/submit") != 0)
+    {
+        return 0;
+    }
+    fields = configFields;
+    return configFieldCount;
+}
 
-    Serial.println("Connecting to WiFi...");
-    while (WiFi.status() != WL_CONNECTED)
+/**
+ * @brief Handle the configuration request and extract SSID and Password
+ * @param client The client to answer
+ * @param request The parsed request
+ */
+void handleConfigRequest(WiFiClient &client, const HttpRequest &request)
+{
+    Serial.println("Handling Config Request...");
+
+    if (strcmp(request.method, "POST") != 0 || strcmp(request.path, "/submit") != 0)
     {
-        status = WiFi.begin(ssid, pass);
-        printWifiStatus();
-        delay(1000);
+        PageWriter page(client);
+        writeHtmlHeader(page);
+        writeConfigPage(page, networks, incorrectPassword);
+        page.flush();
+        return;
+    }
 
-        if ((WiFi.status() == WL_CONNECT_FAILED) || (WiFi.status() == WL_DISCONNECTED))
-        {
-            if (counter == 5)
-            {
-                Serial.println("Connection failed!");
-                printWifiStatus();
-                incorrectPassword = true;
-                needsWiFiConfig = true;
-                ssid[0] = '\0';
-                pass[0] = '\0';
-                startAccessPoint();
-                return;
-            }
-            counter++;
-        }
+    // Decoded as it arrived by routeForm(), unless the mode changed in between
+    if (!request.formDecoded)
+    {
+        parseForm(request.body, request.bodyLength, configFields, configFieldCount);
     }
-    printWifiStatus();
 
-    Serial.println("Connected to WiFi!");
+    // Every field is required; a value cut to fit its buffer would not be the one typed
+    char *idEnd;
+    long sensorId = strtol(formSensorId, &idEnd, 10);
+    bool valid = formSsid[0] != '\0' && formPass[0] != '\0' && formSensorId[0] != '\0' && *idEnd == '\0' &&
+                 sensorId >= 0 && sensorId <= 0xFFFF;
+    for (size_t i = 0; i < configFieldCount; i++)
+    {
+        valid = valid && !configFields[i].truncated;
+    }
+    if (!valid)
+    {
+        Serial.println("Invalid configuration form");
+        PageWriter page(client);
+        writeHtmlHeader(page);
+        writeConfigPage(page, networks, incorrectPassword);
+        page.flush();
+        return;
+    }
+
+    strcpy(ssid, formSsid);
+    strcpy(pass, formPass);
+    sensorDatas.sensorId = (int)sensorId;
+    Serial.println("SSID is : ");
+    Serial.println(ssid);
+    Serial.println("Password is : ");
+    Serial.println(pass);
+    Serial.println("SensorId is : ");
+    Serial.println(sensorDatas.sensorId);
+
+    PageWriter page(client);
+    writeHtmlHeader(page);
+    writeConnectingPage(page, ipWifi);
+    page.flush();
+
+    needsWiFiConfig = false;
+    APMode = false;
+    configStored = false;
+    configSubmitted = true;
+    configSubmittedMillis = millis();
+}
+
+/**
+ * @brief Use the configuration saved in flash, if any
+ * @return true if the board is configured
+ */
+bool loadStoredConfig()
+{
+    StoredConfig config;
+    if (!configStore.load(config))
+    {
+        Serial.println("No configuration in flash");
+        return false;
+    }
+    strncpy(ssid, config.ssid, sizeof(ssid) - 1);
+    ssid[sizeof(ssid) - 1] = '\0';
+    strncpy(pass, config.pass, sizeof(pass) - 1);
+    pass[sizeof(pass) - 1] = '\0';
+    sensorDatas.sensorId = config.sensorId;
+    needsWiFiConfig = false;
+    APMode = false;
+    configStored = true;
+    Serial.print("Configuration loaded from flash, SSID: ");
+    Serial.print(ssid);
+    Serial.print(", sensorId: ");
+    Serial.println(sensorDatas.sensorId);
+    return true;
+}
+
+/**
+ * @brief Start connecting to the Wi-Fi network using the credentials provided by the user. The
+ *        outcome is handled by wifiTask() and does not block the loop.
+ * @param knownCredentials true if the credentials come from flash and already worked
+ */
+void connectToWiFi(bool knownCredentials)
+{
+    Serial.println("Connecting to WiFi...");
+    uplink.stop();
+    // Leave the access point mode
+    WiFi.end();
+    wifiLink.begin(ssid, pass, knownCredentials);
+    maintenanceUntil = millis() + MAINTENANCE_WINDOW;
+}
+
+/**
+ * @brief Start using the network once the WiFi link is up
+ */
+void onWiFiConnected()
+{
+    const WiFiLinkStats &wifi = wifiLink.getStats();
+    printWifiStatus();
+    Serial.print("Connected to WiFi in ");
+    Serial.print(wifi.lastReconnectMs);
+    Serial.print(" ms, ");
+    Serial.print(wifi.lastAttempts);
+    Serial.println(" attempt(s)");
     IPAddress ip = WiFi.localIP();
     Serial.print("IP Address: ");
     Serial.println(ip);
     server.begin();
     connectedToWiFi = true;
     digitalWrite(LED_BUILTIN, LOW);
+    if (!configStored)
+    {
+        configStore.save(ssid, pass, (uint16_t)sensorDatas.sensorId);
+        configStored = true;
+        Serial.println("Configuration saved to flash");
+    }
+    // Do not wait a whole upload interval for the first sample after power-on
+    if (wifi.connections == 1 && !uploadDue)
+    {
+        if (sampleWindow.empty())
+        {
+            readTask();
+        }
+        // Still empty when a sensor read in the background has no value yet
+        if (!sampleWindow.empty())
+        {
+            recordSample();
+            uploadDue = true;
+        }
+    }
+    // Send what piled up while the link was down without waiting for the next sample
+    drainPending = sampleLog.pendingCount() > 0 || pendingSamples.size() >= UPLOAD_BATCH_SIZE;
+}
 
-    delay(500);
+/**
+ * @brief The network refused the credentials, ask the user for new ones in access point mode
+ */
+void onWiFiRejected()
+{
+    Serial.println("Connection failed!");
+    printWifiStatus();
+    connectedToWiFi = false;
+    incorrectPassword = true;
+    needsWiFiConfig = true;
+    ssid[0] = '\0';
+    pass[0] = '\0';
+    startAccessPoint();
 }
 
 /**
  * @brief Prints the web page with the sensor values
+ * @param client The client to answer
+ * @param request The parsed request
  */
-void printWEB()
+void printWEB(WiFiClient &client, const HttpRequest &request)
 {
-    client = server.available();
-    if (client)
+    if (strcmp(request.method, "POST") == 0 && strcmp(request.path, "/reconfigure") == 0)
     {
-        // Read the sensors values to display them
-        readSensors();
-        String currentLine = "";
-        while (client.connected())
+        Serial.println("Reconfiguring wifi");
+        needsWiFiConfig = true;
+        connectedToWiFi = false;
+        incorrectPassword = false;
+        ssid[0] = '\0';
+        pass[0] = '\0';
+        // The page redirects by itself, nothing to display
+        writeHttpStatus(client, "204 No Content");
+        reconfigureRequested = true;
+        return;
+    }
+
+    // The values of the last reading, the sensors are not touched while a client waits
+    PageWriter page(client);
+    writeHtmlHeader(page);
+    writeDataPage(page, ipArduino, sensorDatas);
+    page.flush();
+}
+
+/**
+ * @brief Write the last reading of the sensors as a small JSON object, for the scripts that poll the
+ *        board. The sensors are not read again.
+ * @param out Where the response is written, usually a PageWriter around the client
+ */
+void writeReadingsJson(Print &out)
+{
+    if (readingSequence == 0)
+    {
+        writeHttpStatus(out, "503 Service Unavailable");
+        return;
+    }
+
+    unsigned long now = uptime();
+    doc.clear();
+    doc["id"] = sensorDatas.sensorId;
+    doc["sequence"] = readingSequence;
+    if (wallClock.isKnown())
+    {
+        doc["time"] = wallClock.unixTime(lastReadingAt);
+    }
+    doc["age"] = now - lastReadingAt;
+    for (size_t i = 0; i < SENSOR_FIELD_COUNT; i++)
+    {
+        const SensorField &field = ActiveSensorKit::field(i);
+        setJsonReading(doc[field.key], field, sensorDatas.values[i]);
+    }
+
+    out.print(F("HTTP/1.1 200 OK\r\n"
+                "Content-Type: application/json\r\n"
+                "Connection: close\r\n"
+                "Content-Length: "));
+    out.print((unsigned long)measureJson(doc));
+    out.print(F("\r\n\r\n"));
+    serializeJson(doc, out);
+}
+
+/**
+ * @brief Send the oldest batch of samples to the distant server, those waiting in flash first
+ */
+void sendSensorData()
+{
+    drainPending = false;
+    if (wallClock.due(uptime()))
+    {
+        wallClock.sync(WiFi.getTime(), uptime());
+    }
+
+    LoggedSample batch[UPLOAD_BATCH_SIZE];
+    // The fields the server will hold once it accepted the batch
+    ServerView view = serverView;
+    // Samples in flash are older than the ones in RAM, and may be sent as an incomplete batch
+    bool fromLog = sampleLog.pendingCount() > 0;
+    size_t count = 0;
+    if (fromLog)
+    {
+        count = sampleLog.peek(batch, UPLOAD_BATCH_SIZE);
+    }
+    else if (pendingSamples.size() >= UPLOAD_BATCH_SIZE)
+    {
+        for (; count < UPLOAD_BATCH_SIZE; count++)
         {
+            batch[count] = toLoggedSample(pendingSamples.peek(count));
+        }
+    }
+    if (count == 0)
+    {
+        return;
+    }
+
+    unsigned long encodeStart = micros();
+#if UPLOAD_FORMAT == UPLOAD_FORMAT_BINARY
+    TelemetryWriter writer((uint8_t *)uploadBody, sizeof(uploadBody));
+    size_t length = writer.encode(batch, count);
+    const char *contentType = TELEMETRY_CONTENT_TYPE;
+#else
+    size_t length = serializeSamples(batch, count, fromLog || UPLOAD_BATCH_SIZE > 1, uploadBody, sizeof(uploadBody),
+                                     REPORT_DELTA ? &view : nullptr);
+    const char *contentType = "application/json";
+#endif
+    unsigned long encodeTime = micros() - encodeStart;
+    int statusCode = uplink.post("/sensor-data", contentType, (const uint8_t *)uploadBody, length);
+    const UplinkStats &stats = uplink.getStats();
+    uploadStatus.count(statusCode);
+    uploadLatency.observe(stats.lastLatencyMs);
 
-            if (client.available())
-            {
-
-                char c = client.read();
-
-                if (c == '\n')
-                {
-
-                    if (currentLine.length() == 0)
-                    {
-                        client.println("HTTP/1.1 200 OK");
-                        client.println("Content-type:text/html");
-                        client.println("Connection: close");
-                        client.println();
-
-                        client.println(generateDataPage(ipArduino, sensorDatas));
-                        client.println();
-
-                        break;
-                    }
-                    else if (currentLine.indexOf("POST /reconfigure") >= 0)
-                    {
-                        Serial.println("Reconfiguring wifi");
-                        needsWiFiConfig = true;
-                        connectedToWiFi = false;
-                        incorrectPassword = false;
-                        ssid[0] = '\0';
-                        pass[0] = '\0';
-                        client.flush();
-                        client.stop();
-                        startAccessPoint();
-                        return;
-                    }
-                    else
-                    {
-                        currentLine = "";
-                    }
-                }
-                else if (c != '\r')
-                {
-                    currentLine += c;
-                }
-            }
+    Serial.print("Body: ");
+    Serial.print((unsigned long)length);
+    Serial.print(" bytes for ");
+    Serial.print((unsigned long)count);
+    Serial.print(" samples, encoded in ");
+    Serial.print(encodeTime);
+    Serial.println(" us");
+    Serial.print("Status code: ");
+    Serial.print(statusCode);
+    Serial.print(", latency: ");
+    Serial.print(stats.lastLatencyMs);
+    Serial.print(" ms, connections reused/new: ");
+    Serial.print(stats.reusedConnections);
+    Serial.print("/");
+    Serial.print(stats.newConnections);
+    Serial.print(", samples pending: ");
+    Serial.print(pendingSamples.size());
+    Serial.print(" in RAM, ");
+    Serial.print(sampleLog.pendingCount());
+    Serial.println(" in flash");
+
+    if (statusCode >= 200 && statusCode < 300)
+    {
+        if (firstUploadMs == 0)
+        {
+            firstUploadMs = uptime();
+            Serial.print("First upload ");
+            Serial.print(firstUploadMs);
+            Serial.println(" ms after power-on");
+        }
+        serverView = view;
+        if (fromLog)
+        {
+            sampleLog.consume(count);
         }
+        else
+        {
+            pendingSamples.pop(count);
+        }
+        drainPending = sampleLog.pendingCount() > 0 || pendingSamples.size() >= UPLOAD_BATCH_SIZE;
+    }
+    else if (statusCode < 0 && wifiLink.uploadFailed())
+    {
+        Serial.println("No answer on the cached address, asking DHCP for a new one");
+        connectedToWiFi = false;
+        uplink.stop();
     }
-    client.flush();
-    client.stop();
 }
 
 /**
- * @brief Send the sensor data to the distant server
+ * @brief Move the oldest buffered sample to the flash log while it cannot be uploaded, and program
+ *        the marks of uploaded ones. At most one flash operation (a few ms) per call.
  */
-void sendSensorData()
+void persistSamples()
 {
-    int statusCode = 0;
+    if (!pendingSamples.empty() && (!connectedToWiFi || pendingSamples.size() > persistThreshold))
+    {
+        if (sampleLog.append(toLoggedSample(pendingSamples.peek(0))))
+        {
+            pendingSamples.pop(1);
+        }
+    }
+    else
+    {
+        sampleLog.service();
+    }
+}
 
-    readSensors();
-    String jsonData;
-    serializeJson(doc, jsonData);
+/**
+ * @brief Build the log record of a sample taken during this boot
+ * @param sample The sample
+ */
+LoggedSample toLoggedSample(const sensorSample &sample)
+{
+    LoggedSample record;
+    record.sample = sample;
+    record.time = wallClock.unixTime(sample.takenAt);
+    record.sensorId = (uint16_t)sensorDatas.sensorId;
+    record.boot = sampleLog.bootNumber();
+    return record;
+}
 
-    httpClient.setHttpResponseTimeout(2000);
+/**
+ * @brief Set a JSON value to a reading of a field. Scaled values are written from the fixed point
+ *        text, ArduinoJson would format a float with soft-float math.
+ * @param target The JSON member
+ * @param field The field the reading belongs to
+ * @param value The reading, in 1/field.scale of the unit
+ */
+template <typename TTarget>
+void setJsonReading(TTarget target, const SensorField &field, int16_t value)
+{
+    if (field.scale == 1)
+    {
+        target = value;
+    }
+    else
+    {
+        target = serialized(FixedText(value, field.scale).text);
+    }
+}
 
-    // Send HTTP POST request
-    httpClient.beginRequest();
-    httpClient.post("/sensor-data");
-    httpClient.sendHeader("Content-Type", "application/json");
-    httpClient.sendHeader("Content-Length", String(jsonData.length()));
-    httpClient.sendHeader("Accept", "*/*");
-    httpClient.beginBody();
-    httpClient.print(jsonData);
-    httpClient.endRequest();
-    Serial.println("Request sent!");
+/**
+ * @brief Fill the JSON object of one sample. The plain fields are the means over the upload window,
+ *        the Min/Max fields their extremes and "readings" the number of sensor readings in the window.
+ *        "sequence" and "boot" identify the sample for the server to drop duplicates and order them,
+ *        "time" (Unix seconds) is added whenever the clock was known when it was logged.
+ * @param item The JSON object
+ * @param record The sample
+ * @param annotate Whether to add "age" (ms ago) to the samples of this boot without "time"
+ * @param now uptime() at serialization
+ * @param view Values held by the server, to leave out the fields that did not change; nullptr to
+ *             write every field
+ */
+void writeSampleJson(JsonObject item, const LoggedSample &record, bool annotate, unsigned long now, ServerView *view)
+{
+    const sensorSample &sample = record.sample;
+    item["id"] = record.sensorId;
+    for (size_t i = 0; i < SENSOR_FIELD_COUNT; i++)
+    {
+        const SensorField &field = ActiveSensorKit::field(i);
+        if (field.uploaded && (!view || view->send(i, sample.fields[i].mean)))
+        {
+            setJsonReading(item[field.key], field, sample.fields[i].mean);
+            setJsonReading(item[field.minKey], field, sample.fields[i].min);
+            setJsonReading(item[field.maxKey], field, sample.fields[i].max);
+        }
+    }
+    item["readings"] = sample.readings;
+    item["sequence"] = sample.sequence;
+    item["boot"] = record.boot;
+    if (record.time != 0)
+    {
+        item["time"] = record.time;
+    }
+    else if (annotate && record.boot == sampleLog.bootNumber())
+    {
+        item["age"] = now - sample.takenAt;
+    }
+    if (view)
+    {
+        view->sampleSent();
+    }
+}
 
-    // Get HTTP response
-    statusCode = httpClient.responseStatusCode();
-    String response = httpClient.responseBody();
-    Serial.print("Status code: ");
-    Serial.println(statusCode);
-    Serial.print("Response: ");
-    Serial.println(response);
+/**
+ * @brief Serialize samples as the JSON body of an upload
+ * @param samples The samples, oldest first
+ * @param count Number of samples to serialize
+ * @param annotate Whether to add when each sample was taken, see writeSampleJson()
+ * @param buffer Destination of the JSON text
+ * @param size Size of the destination
+ * @param view See writeSampleJson(), follows the samples in order
+ * @return Length of the JSON text
+ */
+size_t serializeSamples(const LoggedSample *samples, size_t count, bool annotate, char *buffer, size_t size,
+                        ServerView *view)
+{
+    unsigned long now = uptime();
+    doc.clear();
+    if (UPLOAD_BATCH_SIZE == 1)
+    {
+        writeSampleJson(doc.to<JsonObject>(), samples[0], annotate, now, view);
+    }
+    else
+    {
+        JsonArray items = doc.to<JsonArray>();
+        for (size_t i = 0; i < count; i++)
+        {
+            writeSampleJson(items.add<JsonObject>(), samples[i], annotate, now, view);
+        }
+    }
+    return serializeJson(doc, buffer, size);
 }
 
 //--------------------------------------------Other functions--------------------------------------------
 
 /**
  * @brief Read the sensors values
+ * @return false while a sensor has not given its first value
  */
-void readSensors()
+bool readSensors()
 {
-    int tmpLight;
-
-    sensorDatas.soilHumidity = analogRead(0);
-    sensorDatas.temperature = roundf(dht.readTemperature() * 100) / 100;
-    tmpLight = SI1145.ReadVisible();
-
-    // Map sensor values to have a percentage
-    sensorDatas.percentage = map(sensorDatas.soilHumidity, dry, wet, 0, 100);
+    return sensors.read(sensorDatas.values);
+}
 
-    // Read the light sensor, using a threshold to avoid jumping values that can occures and
-    // gives too high or too low values
-    if (tmpLight >= minLight && tmpLight <= maxLight)
+/**
+ * @brief Prints the average cost of a sensor reading (readSensors() and its aggregation) and of the
+ *        serialization of a full upload batch. The Cortex-M0+ has no cycle counter, the cycles are
+ *        derived from micros() at F_CPU over SENSOR_BENCHMARK_RUNS runs. The DHT answers from its
+ *        cache after the first run, so the DHT bus transfer is not part of the average.
+ */
+void benchmarkSensors()
+{
+    const unsigned long cyclesPerMicro = F_CPU / 1000000UL;
+    unsigned long start = micros();
+    for (int i = 0; i < SENSOR_BENCHMARK_RUNS; i++)
     {
-        sensorDatas.light = map(tmpLight, minLight, maxLight, 0, 2000);
+        readSensors();
+        sampleWindow.add(sensorDatas);
     }
-    else if (tmpLight < minLight)
+    unsigned long readUs = micros() - start;
+
+    LoggedSample batch[UPLOAD_BATCH_SIZE];
+    LoggedSample record = toLoggedSample(sampleWindow.close(0, uptime()));
+    for (size_t i = 0; i < UPLOAD_BATCH_SIZE; i++)
     {
-        sensorDatas.light = 0;
+        batch[i] = record;
     }
-    else if (tmpLight > maxLight)
+    start = micros();
+    size_t length = 0;
+    for (int i = 0; i < SENSOR_BENCHMARK_RUNS; i++)
     {
-        sensorDatas.light = 2000;
+        length = serializeSamples(batch, UPLOAD_BATCH_SIZE, true, uploadBody, sizeof(uploadBody), nullptr);
     }
+    unsigned long serializeUs = micros() - start;
 
-    // Create JSON object
-    doc["id"] = sensorDatas.sensorId;
-    doc["temperature"] = sensorDatas.temperature;
-    doc["humidity"] = sensorDatas.percentage;
-    doc["light"] = sensorDatas.light;
+    Serial.print("Benchmark over ");
+    Serial.print(SENSOR_BENCHMARK_RUNS);
+    Serial.print(" runs: reading ");
+    Serial.print((unsigned long)((uint64_t)readUs * cyclesPerMicro / SENSOR_BENCHMARK_RUNS));
+    Serial.print(" cycles, serialization of ");
+    Serial.print((unsigned long)length);
+    Serial.print(" B ");
+    Serial.print((unsigned long)((uint64_t)serializeUs * cyclesPerMicro / SENSOR_BENCHMARK_RUNS));
+    Serial.println(" cycles");
+}
+
+/**
+ * @brief Summarise the readings of the window into a sample and keep it in the upload buffer
+ */
+void recordSample()
+{
+    unsigned long now = uptime();
+    sensorSample sample = sampleWindow.close(sampleLog.takeSequence(), now);
+    reportFilter.reported(sample, now);
+    pendingSamples.push(sample);
+}
+
+/**
+ * @brief Seeds random() once per boot, so the boards of a fleet draw different WiFi backoff jitters:
+ *        the MAC address of the NINA module tells the boards apart, the boot counter the boots
+ */
+void seedRandom()
+{
+    uint8_t mac[6];
+    WiFi.macAddress(mac);
+    // FNV-1a of the MAC address and the boot number
+    uint32_t hash = 2166136261UL;
+    for (uint8_t byte : mac)
+    {
+        hash = (hash ^ byte) * 16777619UL;
+    }
+    uint16_t boot = sampleLog.bootNumber();
+    hash = (hash ^ (boot & 0xFF)) * 16777619UL;
+    hash = (hash ^ (boot >> 8)) * 16777619UL;
+    randomSeed(hash);
 }
 
 /**
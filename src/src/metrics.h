@@ -0,0 +1,202 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  metrics.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Counters and histograms updated on the hot paths, written in the Prometheus text format by
+ *        the /metrics route. Updating one costs a few comparisons and additions, nothing allocates,
+ *        and the output is printed field by field to a PageWriter. Lines end with a bare '\n', the
+ *        "\r\n" of println() is not valid in that format.
+ *
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+#if defined(PLANTKEEPER_NATIVE)
+#include <NativeHAL.h>
+#else
+extern "C" char *sbrk(int increment);
+#endif
+
+/**
+ * @brief Bytes left between the top of the heap and the stack
+ */
+inline unsigned long freeMemory()
+{
+#if defined(PLANTKEEPER_NATIVE)
+    // The host has no such gap, report the 32 KB of the SAMD21 minus what String allocated
+    return 32768UL - (unsigned long)nativeHal::heapStats().current;
+#else
+    char top;
+    return (unsigned long)(&top - sbrk(0));
+#endif
+}
+
+/**
+ * @brief Prints a 64 bit counter, Print has no overload for it on every core
+ */
+inline void printUint64(Print &out, uint64_t value)
+{
+    char digits[21];
+    size_t position = sizeof(digits) - 1;
+    digits[position] = '\0';
+    do
+    {
+        digits[--position] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    out.print(&digits[position]);
+}
+
+/**
+ * @brief Writes the HELP and TYPE lines that precede the samples of a metric
+ */
+inline void writeMetricHeader(Print &out, const char *name, const char *type, const char *help)
+{
+    out.print(F("# HELP "));
+    out.print(name);
+    out.print(' ');
+    out.print(help);
+    out.print('\n');
+    out.print(F("# TYPE "));
+    out.print(name);
+    out.print(' ');
+    out.print(type);
+    out.print('\n');
+}
+
+/**
+ * @brief Writes one sample line
+ * @param labels The labels without braces, for example "task=\"web\"", or nullptr
+ */
+inline void writeMetricValue(Print &out, const char *name, const char *labels, int64_t value)
+{
+    out.print(name);
+    if (labels)
+    {
+        out.print('{');
+        out.print(labels);
+        out.print('}');
+    }
+    out.print(' ');
+    if (value < 0)
+    {
+        out.print('-');
+        value = -value;
+    }
+    printUint64(out, (uint64_t)value);
+    out.print('\n');
+}
+
+/**
+ * @brief Writes a metric that has a single unlabelled sample
+ */
+inline void writeMetric(Print &out, const char *name, const char *type, const char *help, int64_t value)
+{
+    writeMetricHeader(out, name, type, help);
+    writeMetricValue(out, name, nullptr, value);
+}
+
+/**
+ * @brief Distribution of a value over N buckets with fixed upper bounds, plus the +Inf bucket
+ */
+template <size_t N>
+class Histogram
+{
+public:
+    /**
+     * @param bounds Upper bounds of the buckets, increasing. The array must outlive the histogram.
+     */
+    explicit Histogram(const uint32_t *bounds) : bounds(bounds), counts(), total(0), sum(0) {}
+
+    void observe(uint32_t value)
+    {
+        size_t bucket = 0;
+        while (bucket < N && value > bounds[bucket])
+        {
+            bucket++;
+        }
+        counts[bucket]++;
+        total++;
+        sum += value;
+    }
+
+    void write(Print &out, const char *name, const char *help) const
+    {
+        writeMetricHeader(out, name, "histogram", help);
+        uint32_t cumulative = 0;
+        for (size_t i = 0; i <= N; i++)
+        {
+            cumulative += counts[i];
+            out.print(name);
+            out.print(F("_bucket{le=\""));
+            if (i < N)
+            {
+                out.print((unsigned long)bounds[i]);
+            }
+            else
+            {
+                out.print(F("+Inf"));
+            }
+            out.print(F("\"} "));
+            out.print((unsigned long)cumulative);
+            out.print('\n');
+        }
+        out.print(name);
+        out.print(F("_sum "));
+        printUint64(out, sum);
+        out.print('\n');
+        out.print(name);
+        out.print(F("_count "));
+        out.print((unsigned long)total);
+        out.print('\n');
+    }
+
+private:
+    const uint32_t *bounds;
+    uint32_t counts[N + 1];
+    uint32_t total;
+    uint64_t sum;
+};
+
+/**
+ * @brief Number of HTTP responses per status class, negative codes are the errors of HttpClient
+ *        (connection failed, timeout, invalid response)
+ */
+class StatusCounter
+{
+public:
+    StatusCounter() : counts() {}
+
+    void count(int statusCode)
+    {
+        counts[statusCode >= 100 && statusCode < 600 ? statusCode / 100 : 0]++;
+    }
+
+    void write(Print &out, const char *name, const char *help) const
+    {
+        static const char *const labels[] = {"code=\"error\"", "code=\"1xx\"", "code=\"2xx\"",
+                                             "code=\"3xx\"", "code=\"4xx\"", "code=\"5xx\""};
+        writeMetricHeader(out, name, "counter", help);
+        for (size_t i = 0; i < 6; i++)
+        {
+            writeMetricValue(out, name, labels[i], counts[i]);
+        }
+    }
+
+private:
+    uint32_t counts[6];
+};
+
+#endif
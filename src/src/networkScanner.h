@@ -0,0 +1,195 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  networkScanner.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Non-blocking scan of the nearby WiFi networks. WiFi.scanNetworks() waits at least 2 s for the
+ *        module, here the scan is started and its results are collected from loop() once ready.
+ *
+ *        The results are copied into a fixed table, one entry per SSID with its strongest signal, sorted
+ *        from the strongest to the weakest. The table of the previous scan is kept until a new scan
+ *        succeeds, so the configuration page can always be rendered from it.
+ *
+ */
+
+#ifndef NETWORKSCANNER_H
+#define NETWORKSCANNER_H
+
+#include <Arduino.h>
+#include <WiFiNINA.h>
+#include <utility/wifi_drv.h>
+
+// Networks kept from a scan, the weakest are dropped beyond that
+#ifndef NETWORK_SCAN_CAPACITY
+#define NETWORK_SCAN_CAPACITY 10
+#endif
+// Time after which a scan that returned nothing is given up
+#ifndef NETWORK_SCAN_TIMEOUT
+#define NETWORK_SCAN_TIMEOUT 10000
+#endif
+
+/**
+ * @brief A network found by the scan
+ */
+struct ScannedNetwork
+{
+    char ssid[33]; // At most 32 characters
+    int32_t rssi;
+    uint8_t encryption;
+};
+
+class NetworkScanner
+{
+public:
+    NetworkScanner() : count(0), scanning(false), startedAt(0), lastPoll(0), lastDurationMs(0) {}
+
+    /**
+     * @brief Asks the module to scan, the results are collected by poll()
+     * @return false if the module refused to scan
+     */
+    bool start()
+    {
+        if (WiFiDrv::startScanNetworks() == WL_FAILURE)
+        {
+            return false;
+        }
+        scanning = true;
+        startedAt = millis();
+        lastPoll = startedAt;
+        return true;
+    }
+
+    /**
+     * @brief Collects the results of the scan when ready, to be called often from loop(). Queries
+     *        the module at most every 500 ms.
+     * @return true when a scan has just completed
+     */
+    bool poll()
+    {
+        unsigned long now = millis();
+        if (!scanning || now - lastPoll < 500)
+        {
+            return false;
+        }
+        lastPoll = now;
+
+        uint8_t found = WiFiDrv::getScanNetworks();
+        if (found == 0)
+        {
+            if (now - startedAt >= NETWORK_SCAN_TIMEOUT)
+            {
+                scanning = false;
+            }
+            return false;
+        }
+
+        count = 0;
+        for (uint8_t i = 0; i < found; i++)
+        {
+            const char *ssid = WiFi.SSID(i);
+            // Hidden networks cannot be chosen from the list
+            if (ssid && ssid[0] != '\0')
+            {
+                insert(ssid, WiFi.RSSI(i), WiFi.encryptionType(i));
+            }
+        }
+        scanning = false;
+        lastDurationMs = now - startedAt;
+        return true;
+    }
+
+    bool isScanning() const
+    {
+        return scanning;
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    /**
+     * @brief A network of the last completed scan, 0 is the strongest
+     */
+    const ScannedNetwork &operator[](size_t index) const
+    {
+        return networks[index];
+    }
+
+    /**
+     * @brief Time the last completed scan took, from start() to its results
+     */
+    unsigned long lastScanMs() const
+    {
+        return lastDurationMs;
+    }
+
+private:
+    void insert(const char *ssid, int32_t rssi, uint8_t encryption)
+    {
+        // An access point with several radios or a mesh shows the same SSID more than once
+        for (size_t i = 0; i < count; i++)
+        {
+            if (strncmp(networks[i].ssid, ssid, sizeof(networks[i].ssid) - 1) == 0)
+            {
+                if (rssi <= networks[i].rssi)
+                {
+                    return;
+                }
+                remove(i);
+                break;
+            }
+        }
+
+        size_t position = count;
+        while (position > 0 && networks[position - 1].rssi < rssi)
+        {
+            position--;
+        }
+        if (position >= NETWORK_SCAN_CAPACITY)
+        {
+            return;
+        }
+        size_t last = count < NETWORK_SCAN_CAPACITY ? count : NETWORK_SCAN_CAPACITY - 1;
+        for (size_t i = last; i > position; i--)
+        {
+            networks[i] = networks[i - 1];
+        }
+
+        ScannedNetwork &network = networks[position];
+        strncpy(network.ssid, ssid, sizeof(network.ssid) - 1);
+        network.ssid[sizeof(network.ssid) - 1] = '\0';
+        network.rssi = rssi;
+        network.encryption = encryption;
+        if (count < NETWORK_SCAN_CAPACITY)
+        {
+            count++;
+        }
+    }
+
+    void remove(size_t index)
+    {
+        for (size_t i = index + 1; i < count; i++)
+        {
+            networks[i - 1] = networks[i];
+        }
+        count--;
+    }
+
+    ScannedNetwork networks[NETWORK_SCAN_CAPACITY];
+    size_t count;
+    bool scanning;
+    unsigned long startedAt;
+    unsigned long lastPoll;
+    unsigned long lastDurationMs;
+};
+
+#endif
@@ -0,0 +1,141 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  pageWriter.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Buffered writer used to stream web pages to a client without building them in a String
+ *
+ */
+
+#ifndef PAGEWRITER_H
+#define PAGEWRITER_H
+
+#include <Arduino.h>
+
+// Size of the chunks sent to the client. Every write to a WiFiClient is one SPI transaction with the
+// NINA module, so small fields are gathered here instead of being sent one by one.
+#ifndef PAGE_WRITER_CHUNK
+#define PAGE_WRITER_CHUNK 512
+#endif
+
+/**
+ * @brief Print adapter that gathers the output in a fixed buffer and forwards it in chunks
+ */
+class PageWriter : public Print
+{
+public:
+    explicit PageWriter(Print &out) : out(out), used(0), sent(0) {}
+
+    ~PageWriter()
+    {
+        flush();
+    }
+
+    size_t write(uint8_t c) override
+    {
+        if (used == sizeof(chunk))
+        {
+            flush();
+        }
+        chunk[used++] = c;
+        return 1;
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        size_t remaining = size;
+        while (remaining > 0)
+        {
+            if (used == sizeof(chunk))
+            {
+                flush();
+            }
+            size_t n = sizeof(chunk) - used;
+            if (n > remaining)
+            {
+                n = remaining;
+            }
+            memcpy(chunk + used, buffer, n);
+            used += n;
+            buffer += n;
+            remaining -= n;
+        }
+        return size;
+    }
+    using Print::write;
+
+    void flush() override
+    {
+        if (used > 0)
+        {
+            sent += out.write(chunk, used);
+            used = 0;
+        }
+    }
+
+    /**
+     * @brief Number of bytes handed to the underlying client so far
+     */
+    size_t bytesSent() const
+    {
+        return sent + used;
+    }
+
+private:
+    Print &out;
+    uint8_t chunk[PAGE_WRITER_CHUNK];
+    size_t used;
+    size_t sent;
+};
+
+/**
+ * @brief Writes a string with the HTML special characters escaped
+ * @param out The destination
+ * @param text The text to write
+ */
+inline void writeHtmlEscaped(Print &out, const char *text)
+{
+    for (; *text; text++)
+    {
+        switch (*text)
+        {
+        case '<':
+            out.print(F("&lt;"));
+            break;
+        case '>':
+            out.print(F("&gt;"));
+            break;
+        case '&':
+            out.print(F("&amp;"));
+            break;
+        case '"':
+            out.print(F("&quot;"));
+            break;
+        default:
+            out.write((uint8_t)*text);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Writes the status line and headers of a successful HTML response
+ * @param out The destination
+ */
+inline void writeHtmlHeader(Print &out)
+{
+    out.print(F("HTTP/1.1 200 OK\r\n"
+                "Content-type:text/html\r\n"
+                "Connection: close\r\n"
+                "\r\n"));
+}
+
+#endif
@@ -0,0 +1,147 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  reportFilter.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Report-on-change: a sample is only recorded when a reading left the deadband of its field
+ *        (SensorField::deadband) around the last reported mean, or when nothing was reported for a
+ *        heartbeat period. Until then the readings keep adding up in the same window, so the next
+ *        sample covers the silent period and the server knows every reading in it was within the
+ *        deadband of what it holds.
+ *
+ *        ServerView goes one step further for the JSON uploads: a field whose mean is within its
+ *        deadband of the value the server last acknowledged is left out of the sample.
+ *
+ */
+
+#ifndef REPORTFILTER_H
+#define REPORTFILTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sensorData.h"
+
+/**
+ * @brief Whether a value moved out of the deadband of its field around a reference
+ */
+inline bool outsideDeadband(const SensorField &field, int16_t value, int16_t reference)
+{
+    int32_t change = (int32_t)value - reference;
+    return change > field.deadband || change < -field.deadband;
+}
+
+class ReportFilter
+{
+public:
+    /**
+     * @param heartbeat Longest time without a report, in ms
+     */
+    explicit ReportFilter(unsigned long heartbeat)
+        : heartbeat(heartbeat), hasReference(false), changed(false), reportedAt(0), suppressed(0)
+    {
+    }
+
+    /**
+     * @brief Compares a reading of the sensors with the last report
+     */
+    void observe(const int16_t *values)
+    {
+        for (size_t i = 0; i < SENSOR_FIELD_COUNT && hasReference && !changed; i++)
+        {
+            const SensorField &field = ActiveSensorKit::field(i);
+            changed = field.uploaded && outsideDeadband(field, values[i], reference[i]);
+        }
+    }
+
+    /**
+     * @brief Whether the window must be closed into a sample now. Counts the windows kept open.
+     * @param now uptime()
+     */
+    bool due(unsigned long now)
+    {
+        if (!hasReference || changed || now - reportedAt >= heartbeat)
+        {
+            return true;
+        }
+        suppressed++;
+        return false;
+    }
+
+    /**
+     * @brief A sample was recorded, its means become the reference
+     * @param now uptime()
+     */
+    void reported(const sensorSample &sample, unsigned long now)
+    {
+        for (size_t i = 0; i < SENSOR_FIELD_COUNT; i++)
+        {
+            reference[i] = sample.fields[i].mean;
+        }
+        hasReference = true;
+        changed = false;
+        reportedAt = now;
+    }
+
+    /**
+     * @brief Sampling periods that ended without a sample since boot
+     */
+    uint32_t suppressedCount() const
+    {
+        return suppressed;
+    }
+
+private:
+    unsigned long heartbeat;
+    bool hasReference;
+    bool changed;
+    unsigned long reportedAt;
+    int16_t reference[SENSOR_FIELD_COUNT];
+    uint32_t suppressed;
+};
+
+/**
+ * @brief Values of the uploaded fields as the server holds them, for delta uploads. A copy follows
+ *        the samples of an upload and replaces the acknowledged view once the server accepted it.
+ */
+class ServerView
+{
+public:
+    ServerView() : known(false) {}
+
+    /**
+     * @brief Whether a field of a sample must be sent, and if so takes its mean as the server value
+     * @param index Field of the kit
+     * @param mean Mean of the field in the sample
+     */
+    bool send(size_t index, int16_t mean)
+    {
+        if (known && !outsideDeadband(ActiveSensorKit::field(index), mean, values[index]))
+        {
+            return false;
+        }
+        values[index] = mean;
+        return true;
+    }
+
+    /**
+     * @brief Ends a sample, the first one carried every field
+     */
+    void sampleSent()
+    {
+        known = true;
+    }
+
+private:
+    bool known;
+    int16_t values[SENSOR_FIELD_COUNT];
+};
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  sampleBuffer.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Fixed-size ring buffer keeping the samples that have not been uploaded yet
+ *
+ */
+
+#ifndef SAMPLEBUFFER_H
+#define SAMPLEBUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Ring buffer of N elements stored inline, nothing is ever allocated. When the buffer is full
+ *        the oldest element is overwritten, so a long outage keeps the most recent history.
+ */
+template <typename T, size_t N>
+class RingBuffer
+{
+public:
+    RingBuffer() : head(0), count(0), dropped(0) {}
+
+    /**
+     * @brief Appends an element, overwriting the oldest one if the buffer is full
+     */
+    void push(const T &item)
+    {
+        if (count == N)
+        {
+            head = (head + 1) % N;
+            count--;
+            dropped++;
+        }
+        items[(head + count) % N] = item;
+        count++;
+    }
+
+    /**
+     * @brief Element at a position, 0 being the oldest
+     */
+    const T &peek(size_t index) const
+    {
+        return items[(head + index) % N];
+    }
+
+    /**
+     * @brief Removes the n oldest elements
+     */
+    void pop(size_t n)
+    {
+        if (n > count)
+        {
+            n = count;
+        }
+        head = (head + n) % N;
+        count -= n;
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    static size_t capacity()
+    {
+        return N;
+    }
+
+    /**
+     * @brief Number of elements overwritten before they could be removed
+     */
+    uint32_t droppedCount() const
+    {
+        return dropped;
+    }
+
+private:
+    T items[N];
+    size_t head;
+    size_t count;
+    uint32_t dropped;
+};
+
+#endif
@@ -0,0 +1,144 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  sampleWindow.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Running aggregates of the sensor readings taken between two uploads. Each reading updates
+ *        the minimum, maximum and sum in constant time and memory; the last reading is the one kept
+ *        in sensorData for the web page.
+ *
+ */
+
+#ifndef SAMPLEWINDOW_H
+#define SAMPLEWINDOW_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sensorData.h"
+
+/**
+ * @brief Aggregate of one quantity
+ */
+class RunningAggregate
+{
+public:
+    RunningAggregate() { reset(); }
+
+    void add(int16_t value)
+    {
+        if (count == 0 || value < min)
+        {
+            min = value;
+        }
+        if (count == 0 || value > max)
+        {
+            max = value;
+        }
+        sum += value;
+        count++;
+    }
+
+    void reset()
+    {
+        count = 0;
+        sum = 0;
+        min = 0;
+        max = 0;
+    }
+
+    /**
+     * @brief Mean of the values, rounded to the nearest integer
+     */
+    int16_t mean() const
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+        int32_t half = (int32_t)count / 2;
+        return (int16_t)(sum >= 0 ? (sum + half) / (int32_t)count : (sum - half) / (int32_t)count);
+    }
+
+    sensorAggregate summary() const
+    {
+        sensorAggregate aggregate;
+        aggregate.mean = mean();
+        aggregate.min = min;
+        aggregate.max = max;
+        return aggregate;
+    }
+
+private:
+    uint16_t count;
+    int32_t sum;
+    int16_t min;
+    int16_t max;
+};
+
+/**
+ * @brief Readings of every sensor since the last upload window was closed
+ */
+class SampleWindow
+{
+public:
+    SampleWindow() : readings(0) {}
+
+    /**
+     * @brief Adds one reading of the sensors
+     */
+    void add(const sensorData &data)
+    {
+        for (size_t i = 0; i < SENSOR_FIELD_COUNT; i++)
+        {
+            fields[i].add(data.values[i]);
+        }
+        readings++;
+    }
+
+    bool empty() const
+    {
+        return readings == 0;
+    }
+
+    /**
+     * @brief Summarises the window into a sample and starts a new window
+     * @param sequence Sequence number of the sample
+     * @param now millis() at the end of the window
+     */
+    sensorSample close(uint32_t sequence, uint32_t now)
+    {
+        sensorSample sample;
+        sample.sequence = sequence;
+        sample.takenAt = now;
+        sample.readings = readings;
+        for (size_t i = 0; i < SENSOR_FIELD_COUNT; i++)
+        {
+            sample.fields[i] = fields[i].summary();
+        }
+        reset();
+        return sample;
+    }
+
+    void reset()
+    {
+        for (size_t i = 0; i < SENSOR_FIELD_COUNT; i++)
+        {
+            fields[i].reset();
+        }
+        readings = 0;
+    }
+
+private:
+    RunningAggregate fields[SENSOR_FIELD_COUNT];
+    uint16_t readings;
+};
+
+#endif
@@ -0,0 +1,229 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  scheduler.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Cooperative scheduler running the periodic jobs of the firmware from loop(). Tasks live in a
+ *        fixed table sorted by period, so when several are due the most frequent one runs first
+ *        (rate-monotonic order). Nothing is allocated.
+ *
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+#include <limits.h>
+
+/**
+ * @brief Timing statistics of a task since boot
+ */
+struct TaskStats
+{
+    uint32_t runs;
+    uint32_t overruns;            // Runs that took longer than the budget of the task
+    uint32_t skipped;             // Periods missed entirely because the task started too late
+    unsigned long maxLatenessMs;  // Worst delay between the deadline and the start of a run
+    unsigned long maxDurationUs;
+    uint64_t totalDurationUs;
+};
+
+typedef void (*TaskFunction)();
+
+struct Task
+{
+    const char *name;
+    TaskFunction run;
+    unsigned long periodMs;       // 0 runs the task on every tick
+    unsigned long budgetUs;
+    unsigned long nextRun;
+    TaskStats stats;
+};
+
+/**
+ * @brief Table of at most N tasks. A task with a period of 0 runs on every tick, its lateness is
+ *        then the time elapsed since its previous run.
+ */
+template <size_t N>
+class Scheduler
+{
+public:
+    Scheduler() : count(0) {}
+
+    /**
+     * @brief Registers a task, its first run is one period from now
+     * @param name Name used in the statistics
+     * @param run Function of the task
+     * @param periodMs Period in milliseconds
+     * @param budgetUs Duration above which a run is counted as an overrun
+     * @return Whether the task fitted in the table
+     */
+    bool add(const char *name, TaskFunction run, unsigned long periodMs, unsigned long budgetUs)
+    {
+        if (count == N)
+        {
+            return false;
+        }
+
+        // Keep the table sorted by period, tasks of the same period run in the order they were added
+        size_t position = count;
+        while (position > 0 && tasks[position - 1].periodMs > periodMs)
+        {
+            tasks[position] = tasks[position - 1];
+            position--;
+        }
+        Task &task = tasks[position];
+        task.name = name;
+        task.run = run;
+        task.periodMs = periodMs;
+        task.budgetUs = budgetUs;
+        task.nextRun = millis() + periodMs;
+        task.stats = TaskStats();
+        count++;
+        return true;
+    }
+
+    /**
+     * @brief Runs every task that is due, to be called from loop()
+     */
+    void tick()
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            Task &task = tasks[i];
+            unsigned long now = millis();
+            if ((long)(now - task.nextRun) < 0)
+            {
+                continue;
+            }
+
+            unsigned long lateness = now - task.nextRun;
+            unsigned long start = micros();
+            task.run();
+            unsigned long duration = micros() - start;
+
+            TaskStats &stats = task.stats;
+            stats.runs++;
+            stats.totalDurationUs += duration;
+            if (lateness > stats.maxLatenessMs)
+            {
+                stats.maxLatenessMs = lateness;
+            }
+            if (duration > stats.maxDurationUs)
+            {
+                stats.maxDurationUs = duration;
+            }
+            if (duration > task.budgetUs)
+            {
+                stats.overruns++;
+            }
+
+            if (task.periodMs == 0)
+            {
+                task.nextRun = now;
+                continue;
+            }
+            // Keep the phase of the task, but do not run it several times in a row to catch up
+            task.nextRun += task.periodMs;
+            now = millis();
+            if ((long)(now - task.nextRun) >= 0)
+            {
+                unsigned long missed = (now - task.nextRun) / task.periodMs + 1;
+                stats.skipped += missed;
+                task.nextRun += missed * task.periodMs;
+            }
+        }
+    }
+
+    /**
+     * @brief Time until the next periodic task is due, the tasks with a period of 0 are not counted
+     * @return Milliseconds, 0 if a task is already due, ULONG_MAX if there is no periodic task
+     */
+    unsigned long msUntilNextRun() const
+    {
+        unsigned long now = millis();
+        unsigned long shortest = ULONG_MAX;
+        for (size_t i = 0; i < count; i++)
+        {
+            const Task &task = tasks[i];
+            if (task.periodMs == 0)
+            {
+                continue;
+            }
+            long remaining = (long)(task.nextRun - now);
+            if (remaining <= 0)
+            {
+                return 0;
+            }
+            if ((unsigned long)remaining < shortest)
+            {
+                shortest = (unsigned long)remaining;
+            }
+        }
+        return shortest;
+    }
+
+    /**
+     * @brief Accounts for time during which millis() stood still (deep sleep), the deadlines of the
+     *        periodic tasks are brought forward by that much
+     */
+    void advance(unsigned long ms)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (tasks[i].periodMs != 0)
+            {
+                tasks[i].nextRun -= ms;
+            }
+        }
+    }
+
+    /**
+     * @brief Prints one line of statistics per task
+     */
+    void printStats(Print &out) const
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            const Task &task = tasks[i];
+            const TaskStats &stats = task.stats;
+            out.print(task.name);
+            out.print(": runs ");
+            out.print(stats.runs);
+            out.print(", max late ");
+            out.print(stats.maxLatenessMs);
+            out.print(" ms, max run ");
+            out.print(stats.maxDurationUs);
+            out.print(" us, mean run ");
+            out.print(stats.runs ? (unsigned long)(stats.totalDurationUs / stats.runs) : 0UL);
+            out.print(" us, overruns ");
+            out.print(stats.overruns);
+            out.print(", skipped ");
+            out.println(stats.skipped);
+        }
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    const Task &task(size_t index) const
+    {
+        return tasks[index];
+    }
+
+private:
+    Task tasks[N];
+    size_t count;
+};
+
+#endif
@@ -18,16 +18,43 @@
 #ifndef SENSORDATA_H
 #define SENSORDATA_H
 
+#include <stdint.h>
+#include "sensorKits.h"
+
+// Number of values measured by the sensor kit of the build
+#define SENSOR_FIELD_COUNT ActiveSensorKit::fieldCount
+
+static_assert(SENSOR_FIELD_COUNT <= 5, "A sample of the flash log has room for 5 fields");
+
 /**
- * @brief Sensor data structure containing the sensor id, soil humidity, percentage humidity, light and temperature
+ * @brief Sensor data structure containing the sensor id and the last reading of every field of the kit
  */
 typedef struct
 {
     int sensorId;
-    int soilHumidity;
-    int percentage;
-    int light;
-    float temperature;
+    int16_t values[SENSOR_FIELD_COUNT]; // In the order of ActiveSensorKit::field()
 } sensorData;
 
+/**
+ * @brief Mean, minimum and maximum of one quantity over an upload window
+ */
+typedef struct
+{
+    int16_t mean;
+    int16_t min;
+    int16_t max;
+} sensorAggregate;
+
+/**
+ * @brief Compact record of one upload window, as kept in the upload buffer. The sensor id is not
+ *        repeated since it is the same for every record of a board.
+ */
+typedef struct
+{
+    uint32_t sequence;     // Increases with every sample, also across reboots for the logged ones
+    uint32_t takenAt;      // Uptime in ms (deep sleep included) when the window was closed
+    uint16_t readings;     // Number of sensor readings aggregated in the window
+    sensorAggregate fields[SENSOR_FIELD_COUNT]; // In the order of ActiveSensorKit::field()
+} sensorSample;
+
 #endif
\ No newline at end of file
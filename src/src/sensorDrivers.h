@@ -0,0 +1,339 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  sensorDrivers.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Drivers of the sensors a kit can be built from, see sensorRegistry.h. Pins and calibration
+ *        are template parameters, so a kit is fully described by its type.
+ *
+ */
+
+#ifndef SENSORDRIVERS_H
+#define SENSORDRIVERS_H
+
+#include <Arduino.h>
+#include "DHT.h"
+#include "SI114X.h"
+#include "adcSampler.h"
+#include "dhtCapture.h"
+#include "fixedPoint.h"
+#include "sensorRegistry.h"
+#include "soilFilter.h"
+
+// Temperatures are kept in hundredths of degree Celsius
+#define TEMPERATURE_SCALE 100
+// 1 reads the DHT in the background with interrupts (DhtCaptureSensor) instead of the blocking
+// Adafruit driver
+#ifndef DHT_CAPTURE
+#define DHT_CAPTURE 0
+#endif
+// 1 samples the soil probe continuously with the ADC and the DMA and filters it (FilteredSoilSensor)
+// instead of one analogRead() per reading
+#ifndef SOIL_SAMPLER
+#define SOIL_SAMPLER 0
+#endif
+
+/**
+ * @brief DHT11 or DHT22 temperature: "temperature" in hundredths of degree Celsius
+ */
+template <uint8_t Pin, uint8_t Type>
+class DhtSensor
+{
+public:
+    static const size_t fieldCount = 1;
+
+    static const SensorField &field(size_t index)
+    {
+        static const SensorField fields[] = {
+            SENSOR_FIELD("temperature", "Current Temperature", " &deg;C", TEMPERATURE_SCALE, true, 50)};
+        return fields[index];
+    }
+
+    DhtSensor() : dht(Pin, Type), valid(false) {}
+
+    void begin()
+    {
+        dht.begin();
+    }
+
+    void poll() {}
+
+    void advance(unsigned long) {}
+
+    bool busy() const
+    {
+        return false;
+    }
+
+    void printStats(Print &) const {}
+
+    bool read(int16_t *values)
+    {
+        // The DHT driver only gives a float, it is the last float of the pipeline. A failed read
+        // gives NaN and the previous temperature is kept.
+        float celsius = dht.readTemperature();
+        if (!isnan(celsius))
+        {
+            values[0] = (int16_t)toFixed(celsius, TEMPERATURE_SCALE);
+            valid = true;
+        }
+        return valid;
+    }
+
+private:
+    DHT dht;
+    bool valid;
+};
+
+/**
+ * @brief DHT11 or DHT22 temperature read in the background by DhtCapture, read() copies the last
+ *        reading whose checksum matched and costs no bus transfer
+ */
+template <uint8_t Pin, uint8_t Type>
+class DhtCaptureSensor
+{
+public:
+    static const size_t fieldCount = 1;
+
+    static const SensorField &field(size_t index)
+    {
+        return DhtSensor<Pin, Type>::field(index);
+    }
+
+    void begin()
+    {
+        capture.begin();
+    }
+
+    void poll()
+    {
+        capture.poll();
+    }
+
+    void advance(unsigned long ms)
+    {
+        capture.advance(ms);
+    }
+
+    bool busy() const
+    {
+        return capture.busy();
+    }
+
+    bool read(int16_t *values)
+    {
+        if (!capture.hasReading())
+        {
+            return false;
+        }
+        values[0] = capture.lastTemperature();
+        return true;
+    }
+
+    void printStats(Print &out) const
+    {
+        const DhtCaptureStats &stats = capture.getStats();
+        out.print("DHT: readings ");
+        out.print(stats.readings);
+        out.print(", timeouts ");
+        out.print(stats.timeouts);
+        out.print(", checksum errors ");
+        out.print(stats.checksumErrors);
+        if (capture.hasReading())
+        {
+            out.print(", last reading ");
+            out.print(capture.readingAgeMs());
+            out.print(" ms ago");
+        }
+        out.println();
+    }
+
+private:
+    DhtCapture<Pin, Type> capture;
+};
+
+#if DHT_CAPTURE
+// The DHT driver of the kits
+template <uint8_t Pin, uint8_t Type>
+using DhtDriver = DhtCaptureSensor<Pin, Type>;
+#else
+template <uint8_t Pin, uint8_t Type>
+using DhtDriver = DhtSensor<Pin, Type>;
+#endif
+
+/**
+ * @brief Capacitive soil moisture probe on an analog pin: "humidity" in percent and the raw
+ *        "soilHumidity" reading
+ * @tparam Dry Reading in dry air
+ * @tparam Wet Reading in water
+ */
+template <uint8_t Pin, int Dry, int Wet>
+class SoilMoistureSensor
+{
+public:
+    static const size_t fieldCount = 2;
+
+    static const SensorField &field(size_t index)
+    {
+        static const SensorField fields[] = {SENSOR_FIELD("humidity", "Humidity percentage", " %", 1, true, 2),
+                                             SENSOR_FIELD("soilHumidity", nullptr, "", 1, false, 0)};
+        return fields[index];
+    }
+
+    void begin() {}
+
+    void poll() {}
+
+    void advance(unsigned long) {}
+
+    bool busy() const
+    {
+        return false;
+    }
+
+    void printStats(Print &) const {}
+
+    bool read(int16_t *values)
+    {
+        int raw = analogRead(Pin);
+        // A soil wetter than the calibration reads 100
+        values[0] = (int16_t)mapClamped<Dry, Wet, 0, 100>(raw);
+        values[1] = (int16_t)raw;
+        return true;
+    }
+};
+
+/**
+ * @brief Soil moisture probe sampled in the background by AdcSampler and filtered by SoilFilter as
+ *        the results come, read() copies the filtered value. The calibration is in 10-bit readings
+ *        like for SoilMoistureSensor, the filter keeps the 12 bits of the ADC.
+ */
+template <uint8_t Pin, int Dry, int Wet>
+class FilteredSoilSensor
+{
+public:
+    static const size_t fieldCount = 2;
+
+    static const SensorField &field(size_t index)
+    {
+        return SoilMoistureSensor<Pin, Dry, Wet>::field(index);
+    }
+
+    void begin()
+    {
+        sampler.begin();
+    }
+
+    void poll()
+    {
+        uint16_t result;
+        while (sampler.next(result))
+        {
+            filter.add(result);
+        }
+    }
+
+    void advance(unsigned long) {}
+
+    bool busy() const
+    {
+        return false;
+    }
+
+    void printStats(Print &out) const
+    {
+        out.print("Soil: spikes rejected ");
+        out.println(filter.rejected());
+    }
+
+    bool read(int16_t *values)
+    {
+        if (!filter.ready())
+        {
+            return false;
+        }
+        const int extraBits = ADC_SAMPLER_BITS - 10;
+        int filtered = filter.value();
+        values[0] = (int16_t)mapClamped<(long)Dry << extraBits, (long)Wet << extraBits, 0, 100>(filtered);
+        values[1] = (int16_t)((filtered + (1 << (extraBits - 1))) >> extraBits);
+        return true;
+    }
+
+private:
+    AdcSampler<Pin> sampler;
+    SoilFilter filter;
+};
+
+#if SOIL_SAMPLER
+// The soil driver of the kits
+template <uint8_t Pin, int Dry, int Wet>
+using SoilDriver = FilteredSoilSensor<Pin, Dry, Wet>;
+#else
+template <uint8_t Pin, int Dry, int Wet>
+using SoilDriver = SoilMoistureSensor<Pin, Dry, Wet>;
+#endif
+
+/**
+ * @brief Grove sunlight sensor (SI1145) on I2C: "light" from 0 to 2000 and, with Uv, "uv" the UV
+ *        index in hundredths
+ * @tparam MinVisible Visible reading below which the light is 0
+ * @tparam MaxVisible Visible reading above which the light is 2000
+ */
+template <int MinVisible, int MaxVisible, bool Uv = false>
+class SunlightSensor
+{
+public:
+    static const size_t fieldCount = Uv ? 2 : 1;
+
+    static const SensorField &field(size_t index)
+    {
+        static const SensorField fields[] = {SENSOR_FIELD("light", "Visible Light", "", 1, true, 50),
+                                             SENSOR_FIELD("uv", "UV index", "", 100, true, 50)};
+        return fields[index];
+    }
+
+    void begin()
+    {
+        while (!si1145.Begin())
+        {
+            Serial.println("Si1145 is not ready!");
+            delay(1000);
+        }
+    }
+
+    void poll() {}
+
+    void advance(unsigned long) {}
+
+    bool busy() const
+    {
+        return false;
+    }
+
+    void printStats(Print &) const {}
+
+    bool read(int16_t *values)
+    {
+        // The thresholds avoid jumping values that can occures and gives too high or too low values
+        values[0] = (int16_t)mapClamped<MinVisible, MaxVisible, 0, 2000>(si1145.ReadVisible());
+        if (Uv)
+        {
+            // The sensor already gives the index times 100
+            values[1] = (int16_t)si1145.ReadUV();
+        }
+        return true;
+    }
+
+private:
+    SI114X si1145;
+};
+
+#endif
@@ -0,0 +1,47 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  sensorKits.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief The sensor kits the firmware can be built for, selected with -D SENSOR_KIT=... Adding a kit
+ *        is adding a line here; its records, uploads and data page follow from the list of drivers.
+ *
+ */
+
+#ifndef SENSORKITS_H
+#define SENSORKITS_H
+
+#include "sensorDrivers.h"
+
+#define SENSOR_KIT_STANDARD 0
+#define SENSOR_KIT_OUTDOOR 1
+
+#ifndef SENSOR_KIT
+#define SENSOR_KIT SENSOR_KIT_STANDARD
+#endif
+// Data pin of the DHT. DHT_CAPTURE needs an external interrupt on it, which D2 does not have on the
+// MKR boards, so the DHT is then wired to D4
+#ifndef DHT_PIN
+#define DHT_PIN (DHT_CAPTURE ? 4 : 2)
+#endif
+
+#if SENSOR_KIT == SENSOR_KIT_STANDARD
+// DHT11 on DHT_PIN, soil probe on A0 and sunlight sensor on I2C
+typedef SensorKit<DhtDriver<DHT_PIN, DHT11>, SoilDriver<A0, 1023, 700>, SunlightSensor<160, 800>> ActiveSensorKit;
+#elif SENSOR_KIT == SENSOR_KIT_OUTDOOR
+// DHT22 on DHT_PIN for temperatures below 0, soil probe on A0, sunlight sensor with the UV index
+typedef SensorKit<DhtDriver<DHT_PIN, DHT22>, SoilDriver<A0, 1023, 700>, SunlightSensor<160, 800, true>>
+    ActiveSensorKit;
+#else
+#error "Unknown SENSOR_KIT"
+#endif
+
+#endif
@@ -0,0 +1,187 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  sensorRegistry.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Compile-time list of the sensors of a kit. Each driver declares the fields it measures and
+ *        reads them into an array of int16_t; SensorKit chains the drivers of a kit, so the size of
+ *        the records, the JSON keys, the binary layout and the rows of the data page all follow from
+ *        the list. The field count is a constant expression and the descriptions are constant tables,
+ *        nothing is registered at run time.
+ *
+ *        A driver provides:
+ *          static const size_t fieldCount;
+ *          static const SensorField &field(size_t index);  // index < fieldCount
+ *          void begin();
+ *          void poll();                                   // Background work, called on every loop()
+ *          void advance(unsigned long ms);                // millis() stood still for ms (deep sleep)
+ *          bool busy() const;                             // Whether poll() needs the CPU awake
+ *          bool read(int16_t *values);                    // fieldCount values, in field order;
+ *                                                         // false until the sensor gave a first value
+ *          void printStats(Print &out) const;             // Lines for the serial report, may print nothing
+ *
+ */
+
+#ifndef SENSORREGISTRY_H
+#define SENSORREGISTRY_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Description of one measured value
+ */
+struct SensorField
+{
+    const char *key;    // JSON name of the value, and of the mean over an upload window
+    const char *minKey; // JSON name of the minimum over the window
+    const char *maxKey; // JSON name of the maximum over the window
+    const char *label;  // Label on the data page, nullptr to leave it out
+    const char *unit;   // Printed after the value on the data page
+    int16_t scale;      // The value is stored in 1/scale of the unit, a power of ten
+    bool uploaded;      // Whether the JSON samples carry it, the binary records carry every field
+    int16_t deadband;   // Change, in 1/scale of the unit, that is worth a report (REPORT_ON_CHANGE)
+};
+
+// Describes a field, the keys of its extremes are built from its key by the compiler
+#define SENSOR_FIELD(key, label, unit, scale, uploaded, deadband)                                    \
+    {key, key "Min", key "Max", label, unit, scale, uploaded, deadband}
+
+template <typename... Drivers>
+class SensorKit;
+
+/**
+ * @brief The last driver of a kit
+ */
+template <typename Driver>
+class SensorKit<Driver>
+{
+public:
+    static const size_t fieldCount = Driver::fieldCount;
+
+    static const SensorField &field(size_t index)
+    {
+        return Driver::field(index);
+    }
+
+    void begin()
+    {
+        driver.begin();
+    }
+
+    void poll()
+    {
+        driver.poll();
+    }
+
+    void advance(unsigned long ms)
+    {
+        driver.advance(ms);
+    }
+
+    bool busy() const
+    {
+        return driver.busy();
+    }
+
+    bool read(int16_t *values)
+    {
+        return driver.read(values);
+    }
+
+    void printStats(Print &out) const
+    {
+        driver.printStats(out);
+    }
+
+private:
+    Driver driver;
+};
+
+/**
+ * @brief A driver followed by the rest of the kit, its fields come first
+ */
+template <typename Head, typename Next, typename... Tail>
+class SensorKit<Head, Next, Tail...>
+{
+public:
+    static const size_t fieldCount = Head::fieldCount + SensorKit<Next, Tail...>::fieldCount;
+
+    /**
+     * @brief Description of a field of the kit
+     * @param index Position of the field in the records, below fieldCount
+     */
+    static const SensorField &field(size_t index)
+    {
+        return index < Head::fieldCount ? Head::field(index) : SensorKit<Next, Tail...>::field(index - Head::fieldCount);
+    }
+
+    /**
+     * @brief Initialises the sensors, in the order of the kit
+     */
+    void begin()
+    {
+        driver.begin();
+        rest.begin();
+    }
+
+    /**
+     * @brief Lets the drivers that read in the background progress, to be called on every loop()
+     */
+    void poll()
+    {
+        driver.poll();
+        rest.poll();
+    }
+
+    /**
+     * @brief Accounts for a deep sleep, during which millis() stood still
+     */
+    void advance(unsigned long ms)
+    {
+        driver.advance(ms);
+        rest.advance(ms);
+    }
+
+    /**
+     * @brief Whether a driver is in the middle of a conversion that a deep sleep would break
+     */
+    bool busy() const
+    {
+        return driver.busy() || rest.busy();
+    }
+
+    /**
+     * @brief Reads every sensor
+     * @param values Destination of the fieldCount values. A driver that fails to read leaves its
+     *               values unchanged.
+     * @return false while a sensor has not given its first value, the values are then incomplete
+     */
+    bool read(int16_t *values)
+    {
+        bool ready = driver.read(values);
+        return rest.read(values + Head::fieldCount) && ready;
+    }
+
+    /**
+     * @brief Prints the statistics of the drivers that keep some
+     */
+    void printStats(Print &out) const
+    {
+        driver.printStats(out);
+        rest.printStats(out);
+    }
+
+private:
+    Head driver;
+    SensorKit<Next, Tail...> rest;
+};
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  soilFilter.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Incremental filter of the soil probe readings, in integers. Each sample is compared with
+ *        the median of the last few: a sample too far from it is a spike (a bad contact, a WiFi
+ *        burst on the supply) and is replaced by the median. The accepted samples feed an
+ *        exponential moving average, so a real change of the soil still goes through after a few
+ *        samples. Adding a sample costs a sort of the small window, reading the value costs nothing.
+ *
+ */
+
+#ifndef SOILFILTER_H
+#define SOILFILTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Samples the median is taken over, odd
+#ifndef SOIL_MEDIAN_WINDOW
+#define SOIL_MEDIAN_WINDOW 5
+#endif
+// Distance to the median, in input units, above which a sample is rejected
+#ifndef SOIL_OUTLIER_LIMIT
+#define SOIL_OUTLIER_LIMIT 160
+#endif
+// A new sample weighs 1/2^SOIL_EMA_SHIFT in the average
+#ifndef SOIL_EMA_SHIFT
+#define SOIL_EMA_SHIFT 5
+#endif
+// Fractional bits kept by the average
+#define SOIL_EMA_FRACTION 8
+
+static_assert(SOIL_MEDIAN_WINDOW % 2 == 1, "SOIL_MEDIAN_WINDOW must be odd");
+
+class SoilFilter
+{
+public:
+    SoilFilter() : window(), next(0), count(0), average(0), outliers(0) {}
+
+    /**
+     * @brief Filters a new sample
+     */
+    void add(uint16_t sample)
+    {
+        window[next] = sample;
+        next = (next + 1) % SOIL_MEDIAN_WINDOW;
+        if (count < SOIL_MEDIAN_WINDOW)
+        {
+            count++;
+        }
+
+        int32_t accepted = sample;
+        uint16_t center = median();
+        if (accepted > center + SOIL_OUTLIER_LIMIT || accepted < center - SOIL_OUTLIER_LIMIT)
+        {
+            accepted = center;
+            outliers++;
+        }
+        accepted <<= SOIL_EMA_FRACTION;
+
+        // The first sample sets the average instead of being pulled from 0
+        if (count == 1)
+        {
+            average = accepted;
+        }
+        else
+        {
+            average += (accepted - average) >> SOIL_EMA_SHIFT;
+        }
+    }
+
+    /**
+     * @brief Whether a sample was added since the filter was created or reset
+     */
+    bool ready() const
+    {
+        return count > 0;
+    }
+
+    /**
+     * @brief Filtered value, in the units of the samples
+     */
+    uint16_t value() const
+    {
+        return (uint16_t)((average + (1 << (SOIL_EMA_FRACTION - 1))) >> SOIL_EMA_FRACTION);
+    }
+
+    /**
+     * @brief Samples replaced by the median since the filter was created
+     */
+    uint32_t rejected() const
+    {
+        return outliers;
+    }
+
+private:
+    /**
+     * @brief Median of the samples in the window, by an insertion sort of a copy
+     */
+    uint16_t median() const
+    {
+        uint16_t sorted[SOIL_MEDIAN_WINDOW];
+        for (size_t i = 0; i < count; i++)
+        {
+            uint16_t sample = window[i];
+            size_t j = i;
+            for (; j > 0 && sorted[j - 1] > sample; j--)
+            {
+                sorted[j] = sorted[j - 1];
+            }
+            sorted[j] = sample;
+        }
+        return sorted[count / 2];
+    }
+
+    uint16_t window[SOIL_MEDIAN_WINDOW];
+    size_t next;
+    size_t count;
+    // Fixed point with SOIL_EMA_FRACTION fractional bits
+    int32_t average;
+    uint32_t outliers;
+};
+
+#endif
@@ -0,0 +1,114 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  telemetry.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Compact binary encoding of the uploaded samples, an alternative to the JSON body selected
+ *        with -D UPLOAD_FORMAT=UPLOAD_FORMAT_BINARY.
+ *
+ *        Every field is little-endian and has a fixed size, so the server can decode the body with a
+ *        single struct.unpack per record:
+ *
+ *          header (6 bytes)   uint8 version, uint8 count, uint16 sensorId, uint8 kit, uint8 fields
+ *          record             uint32 sequence, uint32 time, uint16 boot, uint16 readings, then
+ *                             int16 mean, min, max of each field of the kit (12 + 6 * fields bytes)
+ *
+ *        kit is the SENSOR_KIT of the build and the fields come in the order of its drivers, see
+ *        sensorKits.h. The standard kit sends temperature (hundredths of degree Celsius), humidity,
+ *        soilHumidity and light, 36 bytes per record. time is in Unix seconds, 0 when the clock was
+ *        not known; readings is the number of sensor readings aggregated in the record.
+ *        (boot, sequence) identifies a sample, so the server can drop the copies a power cut may cause.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "flashLog.h"
+
+#define UPLOAD_FORMAT_JSON 0
+#define UPLOAD_FORMAT_BINARY 1
+
+#define TELEMETRY_CONTENT_TYPE "application/vnd.plantkeeper.samples.v3"
+#define TELEMETRY_VERSION 3
+#define TELEMETRY_HEADER_SIZE 6
+#define TELEMETRY_RECORD_SIZE (12 + 6 * SENSOR_FIELD_COUNT)
+
+class TelemetryWriter
+{
+public:
+    TelemetryWriter(uint8_t *buffer, size_t size) : buffer(buffer), size(size), length(0) {}
+
+    /**
+     * @brief Encodes samples of one sensor
+     * @param samples The samples, oldest first
+     * @param count Number of samples, at most 255
+     * @return Length of the body, 0 if it does not fit in the buffer
+     */
+    size_t encode(const LoggedSample *samples, size_t count)
+    {
+        length = 0;
+        if (count == 0 || count > 255 || TELEMETRY_HEADER_SIZE + count * TELEMETRY_RECORD_SIZE > size)
+        {
+            return 0;
+        }
+        put8(TELEMETRY_VERSION);
+        put8((uint8_t)count);
+        put16(samples[0].sensorId);
+        put8(SENSOR_KIT);
+        put8((uint8_t)SENSOR_FIELD_COUNT);
+        for (size_t i = 0; i < count; i++)
+        {
+            const LoggedSample &record = samples[i];
+            put32(record.sample.sequence);
+            put32(record.time);
+            put16(record.boot);
+            put16(record.sample.readings);
+            for (size_t field = 0; field < SENSOR_FIELD_COUNT; field++)
+            {
+                putAggregate(record.sample.fields[field]);
+            }
+        }
+        return length;
+    }
+
+private:
+    void putAggregate(const sensorAggregate &aggregate)
+    {
+        put16((uint16_t)aggregate.mean);
+        put16((uint16_t)aggregate.min);
+        put16((uint16_t)aggregate.max);
+    }
+
+    void put8(uint8_t value)
+    {
+        buffer[length++] = value;
+    }
+
+    void put16(uint16_t value)
+    {
+        put8((uint8_t)value);
+        put8((uint8_t)(value >> 8));
+    }
+
+    void put32(uint32_t value)
+    {
+        put16((uint16_t)value);
+        put16((uint16_t)(value >> 16));
+    }
+
+    uint8_t *buffer;
+    size_t size;
+    size_t length;
+};
+
+#endif
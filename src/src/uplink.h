@@ -0,0 +1,181 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  uplink.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief HTTP/1.1 keep-alive connection to the distant server. The TCP connection is reused from one
+ *        upload to the next, re-opened when the server dropped it, and responses are discarded
+ *        without being buffered.
+ *
+ */
+
+#ifndef UPLINK_H
+#define UPLINK_H
+
+#include <Arduino.h>
+#include <ArduinoHttpClient.h>
+
+// Time allowed for the server to start answering
+#ifndef UPLINK_RESPONSE_TIMEOUT
+#define UPLINK_RESPONSE_TIMEOUT 2000
+#endif
+
+/**
+ * @brief Counters describing the uplink since boot
+ */
+struct UplinkStats
+{
+    uint32_t requests;
+    uint32_t newConnections;
+    uint32_t reusedConnections;
+    uint32_t failures;
+    int lastStatusCode;
+    unsigned long lastLatencyMs;
+    unsigned long maxLatencyMs;
+    unsigned long totalLatencyMs;
+};
+
+class Uplink
+{
+public:
+    Uplink(Client &client, HttpClient &http) : client(client), http(http), stats() {}
+
+    void begin()
+    {
+        http.connectionKeepAlive();
+        http.setHttpResponseTimeout(UPLINK_RESPONSE_TIMEOUT);
+    }
+
+    /**
+     * @brief Posts a body on the kept-alive connection
+     * @param path The path on the server
+     * @param contentType Value of the Content-Type header
+     * @param body The body to send
+     * @param length Length of the body
+     * @return The HTTP status code, or a negative HttpClient error
+     */
+    int post(const char *path, const char *contentType, const uint8_t *body, size_t length)
+    {
+        unsigned long start = millis();
+        bool reused = client.connected();
+        int statusCode = send(path, contentType, body, length);
+
+        // A server closes idle keep-alive connections whenever it wants: if the reused socket turned
+        // out to be dead, try once more on a fresh one before reporting a failure
+        if (statusCode < 0 && reused)
+        {
+            reused = false;
+            statusCode = send(path, contentType, body, length);
+        }
+
+        unsigned long latency = millis() - start;
+        stats.requests++;
+        if (reused)
+        {
+            stats.reusedConnections++;
+        }
+        else
+        {
+            stats.newConnections++;
+        }
+        if (statusCode < 200 || statusCode >= 300)
+        {
+            stats.failures++;
+        }
+        stats.lastStatusCode = statusCode;
+        stats.lastLatencyMs = latency;
+        stats.totalLatencyMs += latency;
+        if (latency > stats.maxLatencyMs)
+        {
+            stats.maxLatencyMs = latency;
+        }
+        return statusCode;
+    }
+
+    /**
+     * @brief Closes the connection, the next post opens a new one
+     */
+    void stop()
+    {
+        http.stop();
+    }
+
+    const UplinkStats &getStats() const
+    {
+        return stats;
+    }
+
+private:
+    int send(const char *path, const char *contentType, const uint8_t *body, size_t length)
+    {
+        http.beginRequest();
+        int err = http.post(path);
+        if (err != HTTP_SUCCESS)
+        {
+            http.stop();
+            return err;
+        }
+        http.sendHeader("Content-Type", contentType);
+        http.sendHeader("Content-Length", (int)length);
+        http.sendHeader("Accept", "*/*");
+        http.beginBody();
+        http.write(body, length);
+        http.endRequest();
+
+        int statusCode = http.responseStatusCode();
+        if (statusCode < 0 || !discardBody())
+        {
+            http.stop();
+        }
+        return statusCode;
+    }
+
+    /**
+     * @brief Reads the response body into a small scratch buffer and drops it
+     * @return Whether the connection is left in a state where it can be reused
+     */
+    bool discardBody()
+    {
+        int length = http.contentLength();
+        if (length == HttpClient::kNoContentLengthHeader)
+        {
+            // The body ends when the server closes the connection, nothing to reuse
+            return false;
+        }
+
+        uint8_t scratch[32];
+        unsigned long start = millis();
+        while (!http.endOfBodyReached())
+        {
+            if (millis() - start > UPLINK_RESPONSE_TIMEOUT)
+            {
+                return false;
+            }
+            int available = http.available();
+            if (available <= 0)
+            {
+                if (!http.connected())
+                {
+                    return false;
+                }
+                continue;
+            }
+            http.read(scratch, available < (int)sizeof(scratch) ? available : (int)sizeof(scratch));
+        }
+        return true;
+    }
+
+    Client &client;
+    HttpClient &http;
+    UplinkStats stats;
+};
+
+#endif
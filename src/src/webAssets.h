@@ -0,0 +1,170 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @file  webAssets.h
+ * @see https://github.com/Plant-keeper
+ *
+ * @brief Static files of the web interface, generated from web/ by scripts/webAssets.py. Do not edit.
+ *
+ */
+
+#ifndef WEBASSETS_H
+#define WEBASSETS_H
+
+#include <Arduino.h>
+
+/**
+ * @brief A file served as it is, with its gzip encoding for the clients that accept it
+ */
+struct WebAsset
+{
+    const char *path;
+    const char *contentType;
+    const char *etag; // Hash of the content, without the quotes and the suffix of the gzip encoding
+    const uint8_t *plain;
+    size_t plainSize;
+    const uint8_t *gzip;
+    size_t gzipSize;
+};
+
+static const uint8_t appJsPlain[] PROGMEM = {
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x46,
+    0x6f, 0x72, 0x6d, 0x41, 0x6e, 0x64, 0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x28, 0x29,
+    0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x53, 0x75, 0x62, 0x6d, 0x69, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61,
+    0x72, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+    0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64,
+    0x28, 0x27, 0x72, 0x65, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x46, 0x6f, 0x72, 0x6d, 0x27, 0x29,
+    0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x73, 0x75, 0x62, 0x6d, 0x69,
+    0x74, 0x28, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x57, 0x61, 0x69,
+    0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20,
+    0x74, 0x6f, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x69, 0x74, 0x73, 0x20, 0x61, 0x63, 0x63,
+    0x65, 0x73, 0x73, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
+    0x20, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f,
+    0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x61, 0x67, 0x65,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x6c, 0x6f, 0x63, 0x61,
+    0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x68, 0x72, 0x65, 0x66, 0x20, 0x3d, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+    0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2e, 0x6e, 0x65, 0x78, 0x74, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x7d, 0x2c, 0x20, 0x33, 0x30, 0x30, 0x30, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a,
+    0x2f, 0x2f, 0x20, 0x52, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+    0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64,
+    0x61, 0x74, 0x61, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6d,
+    0x0a, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
+    0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x6c, 0x6f, 0x61, 0x64, 0x27, 0x2c,
+    0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x45, 0x76,
+    0x65, 0x6e, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x53, 0x6f, 0x75,
+    0x72, 0x63, 0x65, 0x28, 0x27, 0x2f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x27, 0x29, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76,
+    0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x72, 0x65, 0x61,
+    0x64, 0x69, 0x6e, 0x67, 0x27, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28,
+    0x65, 0x76, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x76, 0x61, 0x72, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x4a,
+    0x53, 0x4f, 0x4e, 0x2e, 0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e,
+    0x64, 0x61, 0x74, 0x61, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+    0x6f, 0x72, 0x20, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x72,
+    0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+    0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74,
+    0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x6b, 0x65, 0x79, 0x29,
+    0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+    0x20, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x65,
+    0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+    0x20, 0x3d, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x5b, 0x6b, 0x65, 0x79, 0x5d, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b,
+    0x0a, 0x7d, 0x29, 0x3b, 0x0a,
+};
+
+static const uint8_t appJsGzip[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7d, 0x52, 0x5f, 0x4b, 0xc3, 0x30,
+    0x10, 0x7f, 0xef, 0xa7, 0x38, 0x9f, 0x5a, 0x41, 0xba, 0x81, 0x8f, 0xe2, 0x83, 0xca, 0x04, 0x45,
+    0x14, 0x36, 0xc1, 0x07, 0xf1, 0x21, 0x6b, 0xae, 0x5d, 0x70, 0x4d, 0x46, 0x72, 0xdd, 0x1c, 0xb2,
+    0xef, 0xee, 0xe5, 0x9a, 0x4a, 0xa7, 0x62, 0xa0, 0xd0, 0x4b, 0x7e, 0xff, 0x2e, 0xb9, 0xba, 0xb3,
+    0x15, 0x19, 0x67, 0x21, 0x74, 0xcb, 0xd6, 0xd0, 0xad, 0xf3, 0xed, 0x95, 0xd5, 0x73, 0xd4, 0xc6,
+    0x63, 0x45, 0xc5, 0x29, 0x7c, 0x66, 0xc0, 0x6b, 0x32, 0x81, 0x85, 0x00, 0x80, 0x56, 0x08, 0x35,
+    0xa3, 0x64, 0x7b, 0xab, 0xbc, 0x14, 0x70, 0x09, 0xda, 0x55, 0x5d, 0x8b, 0x96, 0xca, 0x06, 0x69,
+    0xb6, 0xc6, 0xf8, 0x7b, 0xbd, 0xbf, 0xd3, 0x45, 0xce, 0x3a, 0xce, 0xd6, 0xa6, 0x89, 0xd2, 0xf9,
+    0xe9, 0x85, 0xf0, 0x22, 0xa7, 0xec, 0x1d, 0x0b, 0xde, 0x1a, 0x2c, 0x5e, 0x14, 0x1b, 0xf0, 0x99,
+    0x98, 0x2c, 0x9d, 0xf2, 0x1a, 0xc8, 0x41, 0x20, 0xe5, 0x09, 0x0c, 0x05, 0x50, 0x55, 0x85, 0x21,
+    0xc0, 0xc6, 0x19, 0x4b, 0xb0, 0x44, 0x46, 0x22, 0x34, 0x5c, 0x34, 0x11, 0x16, 0x39, 0xbd, 0x53,
+    0xe7, 0x95, 0xb4, 0xb4, 0x51, 0x0d, 0x8a, 0x74, 0x40, 0x7a, 0x36, 0x2d, 0xba, 0x8e, 0x8a, 0x3a,
+    0xf5, 0xfb, 0xdd, 0x59, 0x5c, 0x3b, 0x63, 0xb5, 0xdb, 0x95, 0x6b, 0x57, 0x09, 0xb1, 0x5c, 0x79,
+    0xac, 0xb9, 0x25, 0x49, 0xa9, 0x15, 0x29, 0xe6, 0x97, 0x16, 0x3f, 0xa8, 0x0f, 0x7f, 0x38, 0x83,
+    0xf3, 0xe9, 0x74, 0xca, 0xb9, 0x0f, 0x59, 0xc6, 0xa9, 0xe7, 0xb8, 0x59, 0xab, 0x0a, 0x25, 0x80,
+    0x47, 0xa5, 0x39, 0x4f, 0x00, 0x57, 0x4b, 0x1d, 0xd9, 0x92, 0x03, 0x54, 0x18, 0x75, 0x15, 0xd0,
+    0x6a, 0xa9, 0xdb, 0x2c, 0x79, 0x2b, 0xad, 0x67, 0x5b, 0xbe, 0xb3, 0x07, 0x13, 0x08, 0x2d, 0xfa,
+    0x22, 0x5f, 0x3b, 0xa5, 0xf3, 0x33, 0xf8, 0x15, 0xd8, 0xd4, 0x50, 0x9c, 0x24, 0x96, 0x50, 0x16,
+    0xae, 0xf3, 0x15, 0x8e, 0xfb, 0xf1, 0x48, 0x9d, 0xb7, 0x29, 0xed, 0xf7, 0x43, 0x05, 0xc1, 0x71,
+    0x5f, 0x16, 0x77, 0x30, 0x62, 0x16, 0xf9, 0x04, 0x63, 0x15, 0x86, 0xd7, 0xe9, 0x81, 0x7f, 0x44,
+    0x4a, 0xdd, 0x8d, 0x53, 0x09, 0x73, 0xec, 0x1d, 0x9d, 0x12, 0x8e, 0xad, 0xee, 0x17, 0x4f, 0x8f,
+    0xe5, 0x46, 0xf9, 0x80, 0x3d, 0x52, 0xae, 0x33, 0xd9, 0xa4, 0x41, 0x80, 0x22, 0x52, 0xde, 0x71,
+    0x0f, 0xc6, 0x0e, 0xcc, 0xb1, 0xe0, 0x20, 0x8a, 0xfd, 0x50, 0xfd, 0x33, 0x6a, 0xac, 0x31, 0x92,
+    0x1e, 0xee, 0x2a, 0xf1, 0x7e, 0x4a, 0xc6, 0x95, 0x8e, 0x4a, 0xe2, 0xb7, 0xbd, 0x71, 0x96, 0x7a,
+    0xf9, 0x94, 0xe1, 0x95, 0xe5, 0xde, 0x8e, 0xe5, 0x0e, 0xd9, 0xf1, 0xdf, 0x21, 0xce, 0x00, 0x7f,
+    0x5f, 0xb1, 0x66, 0x1c, 0x0b, 0x45, 0x03, 0x00, 0x00,
+};
+
+static const uint8_t styleCssPlain[] PROGMEM = {
+    0x62, 0x6f, 0x64, 0x79, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67,
+    0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x30, 0x61, 0x30, 0x61, 0x32, 0x33, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79,
+    0x3a, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65,
+    0x72, 0x69, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a,
+    0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a,
+    0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d,
+    0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x7d,
+    0x0a, 0x0a, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2c,
+    0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69,
+    0x64, 0x74, 0x68, 0x3a, 0x20, 0x35, 0x30, 0x25, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61,
+    0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20,
+    0x31, 0x35, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+    0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x35, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a,
+    0x7d, 0x0a, 0x0a, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73,
+    0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x5d, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20,
+    0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+    0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x34, 0x43, 0x41, 0x46, 0x35, 0x30, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x77, 0x68, 0x69, 0x74,
+    0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x20, 0x70,
+    0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x61, 0x20, 0x7b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x34, 0x43, 0x41, 0x46, 0x35,
+    0x30, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x2e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x7b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x72, 0x65, 0x64, 0x3b, 0x0a, 0x7d,
+    0x0a,
+};
+
+static const uint8_t styleCssGzip[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5d, 0x90, 0xc1, 0x6e, 0xc3, 0x20,
+    0x10, 0x44, 0xef, 0xfe, 0x0a, 0x94, 0xaa, 0xb7, 0x52, 0xd1, 0xb4, 0xbe, 0x10, 0xf5, 0x10, 0x55,
+    0xea, 0x4f, 0x54, 0x3d, 0x80, 0x59, 0x3b, 0xab, 0x60, 0xd6, 0x5a, 0x40, 0x89, 0x55, 0xf5, 0xdf,
+    0x4b, 0x6a, 0x27, 0x91, 0xcd, 0x05, 0x31, 0x6f, 0x19, 0x86, 0xb1, 0xe4, 0x46, 0xf1, 0x53, 0x89,
+    0xb2, 0xac, 0x69, 0x8e, 0x1d, 0x53, 0x0e, 0x4e, 0x8b, 0x07, 0x65, 0x94, 0xd9, 0xbe, 0xee, 0xfe,
+    0x41, 0x43, 0x9e, 0xb8, 0x68, 0x6d, 0xdb, 0x4e, 0x42, 0x4b, 0x21, 0xc9, 0xd6, 0xf4, 0xe8, 0x47,
+    0x2d, 0xf6, 0x8c, 0xc6, 0x3f, 0x89, 0x68, 0x42, 0x94, 0x11, 0x18, 0xe7, 0x99, 0xde, 0x70, 0x87,
+    0x41, 0x0b, 0x35, 0x1d, 0x07, 0xe3, 0x1c, 0x86, 0x4e, 0x8b, 0xad, 0x1a, 0xce, 0x93, 0x94, 0xe0,
+    0x9c, 0xa4, 0xf1, 0xd8, 0x95, 0xa9, 0x06, 0x42, 0x02, 0xde, 0x55, 0xbf, 0x55, 0x85, 0x61, 0xc8,
+    0xa9, 0xf8, 0x81, 0x87, 0xa6, 0xec, 0x36, 0xa7, 0x44, 0x61, 0x8e, 0x78, 0x42, 0x97, 0x0e, 0x5a,
+    0xd4, 0xea, 0x71, 0xe5, 0xfa, 0x72, 0x73, 0x9d, 0xde, 0x95, 0x96, 0xca, 0xb5, 0xbe, 0x80, 0xfa,
+    0x0a, 0x2c, 0xb1, 0x03, 0x96, 0x6c, 0x1c, 0xe6, 0x58, 0x3c, 0x96, 0xba, 0x16, 0x81, 0x02, 0xdc,
+    0x03, 0x7c, 0xa5, 0x71, 0x80, 0xf7, 0x4d, 0xcc, 0xb6, 0xc7, 0xb4, 0xf9, 0x5e, 0xe5, 0xb8, 0x57,
+    0x25, 0xaf, 0xe5, 0xbc, 0x7d, 0xec, 0x3f, 0x6b, 0xb5, 0x28, 0xec, 0x74, 0xc0, 0x04, 0xb3, 0x92,
+    0x39, 0x5e, 0xa4, 0x81, 0xf0, 0xf6, 0x51, 0x33, 0x9b, 0xad, 0x1d, 0x0a, 0x7a, 0x06, 0x66, 0xe2,
+    0x25, 0x67, 0x70, 0x17, 0xf6, 0x07, 0x7b, 0x36, 0xaa, 0xe2, 0xb1, 0x01, 0x00, 0x00,
+};
+
+static const WebAsset webAssets[] = {
+    {"/app.js", "application/javascript", "5eaa9e9d8ffd", appJsPlain, sizeof(appJsPlain), appJsGzip, sizeof(appJsGzip)},
+    {"/style.css", "text/css", "f573db5dee54", styleCssPlain, sizeof(styleCssPlain), styleCssGzip, sizeof(styleCssGzip)},
+};
+
+#endif
@@ -18,175 +18,250 @@
 #ifndef WEBPAGES_H
 #define WEBPAGES_H
 #include "sensorData.h"
+#include "fixedPoint.h"
+#include "networkScanner.h"
+#include "pageWriter.h"
+#include "httpServer.h"
+#include "webAssets.h"
 
-/**
- * @brief Generates the configuration page to connect to a WiFi network
- * @param networks The list of available networks
- * @param passwordFailed Whether the password entered was incorrect
- */
-String generateConfigPage(std::vector<const char *> networks, bool passwordFailed)
-{     
-    String webpage = R"rawliteral(
-<!DOCTYPE html>
+// The constant parts of the pages live in flash and are streamed as they are, only the small
+// dynamic fields are formatted while writing. No page is ever assembled in RAM. The stylesheet and
+// the script are static files (web/, see webAssets.h) the browser keeps in its cache.
+
+static const char configPageHead[] PROGMEM = R"rawliteral(<!DOCTYPE html>
 <html>
 <head>
     <title>WiFi Configuration</title>
+    <link rel="stylesheet" href="/style.css">
 </head>
-<style>
-  body {
-            background: #0a0a23;
-            color: #fff;
-            font-family: Arial, sans-serif;
-            margin: 0;
-            padding: 20px;
-            text-align: center;
-        }
-
-        input, select {
-            width: 50%;
-            padding: 10px;
-            margin-bottom: 15px;
-            border-radius: 5px;
-            border: none;
-        }
-
-        input[type="submit"] {
-            background-color: #4CAF50;
-            color: white;
-            cursor: pointer;
-        }
-</style>
 <body>
-    <h1>WiFi Configuration</h1>  
-  <label for="ssid">Select a network:</label>
-       <form action="/submit" method="POST">
-<select name="ssid" id="ssid"> )rawliteral";
-    for (auto network : networks)
-    {
-        webpage += "<option value=\"" + String(network) + "\">" + String(network) + "</option>";
-    }
-    webpage += R"rawliteral(
-</select>
-<br><br>
+    <h1>WiFi Configuration</h1>
+    <label for="ssid">Select a network:</label>
+    <form action="/submit" method="POST">
+        <select name="ssid" id="ssid">)rawliteral";
 
+static const char configPageForm[] PROGMEM = R"rawliteral(</select>
+        <br><br>
         <label for="pass">Password:</label><br>
         <input type="password" id="pass" name="pass"><br><br>
         <label for="idsensor">Enter your sensor id:</label><br>
         <input type="number" id="idsensor" name="idsensor"><br><br>
         <input type="submit" value="Submit">
     </form>
-    )rawliteral";
-    if(passwordFailed) {
-        webpage += "<p style=\"color: red;\">You've entered an incorrect password. Please try again.</p>";
-    }
-    
-      webpage += R"rawliteral(
-</body>
-</html>
 )rawliteral";
-    return webpage;
-}
 
-/**
- * @brief Generates the connecting page to be displayed while the arduino is connecting to the WiFi network
- * @param IP The IP address of the arduino
- */
-String generateConnectingPage(String IP)
-{
-    String webpage = R"rawliteral(
+static const char configPageScanning[] PROGMEM = R"rawliteral(    <p>Scanning for networks...</p>
+    <script>setTimeout(function() { window.location.href = '/'; }, 3000);</script>
+)rawliteral";
+
+static const char configPageFailed[] PROGMEM =
+    "    <p class=\"error\">You've entered an incorrect password. Please try again.</p>\n";
+
+static const char pageTail[] PROGMEM = R"rawliteral(</body>
+</html>
+)rawliteral";
 
-<!DOCTYPE html>
+static const char connectingPageHead[] PROGMEM = R"rawliteral(<!DOCTYPE html>
 <html>
 <head>
     <title>WiFi Configuration</title>
+    <link rel="stylesheet" href="/style.css">
 </head>
-<style>
- body {
-            background: #0a0a23;
-            color: #fff;
-            font-family: Arial, sans-serif;
-            margin: 0;
-            padding: 20px;
-            text-align: center;
-        }
-
-</style>
 <body>
     <h1>Your sensor is connecting!</h1>
     <p>The device is now connecting to the specified WiFi network. If you cannot access to your datas
     then you might have entered an incorect password. Check the previous ip page and reconnect to the wifi in that case </p>
-    <p> To access to your datas, click on this link <a href=" )rawliteral";
-    webpage += IP ;
-    webpage += R"rawliteral( "> datas </a>   </p>
+    <p> To access to your datas, click on this link <a href=")rawliteral";
+
+static const char connectingPageTail[] PROGMEM = R"rawliteral("> datas </a></p>
 </body>
 </html>
 )rawliteral";
-    return webpage;
-}
 
-/**
- * @brief Generates the data page to display the sensor data
- * @param IP The IP address of the arduino
- * @param data The sensor datas to be displayed
- */
-String generateDataPage(String IP, sensorData data) {
-    String webpage = R"rawliteral(
-<!DOCTYPE html>
+static const char dataPageHead[] PROGMEM = R"rawliteral(<!DOCTYPE html>
 <html>
 <head>
     <title>Hello Plant</title>
+    <link rel="stylesheet" href="/style.css">
+    <script src="/app.js"></script>
 </head>
-<style>
- body {
-            background: #0a0a23;
-            color: #fff;
-            font-family: Arial, sans-serif;
-            margin: 0;
-            padding: 20px;
-            text-align: center;
-        }
-
-        button {
-            width: 50%;
-            padding: 10px;
-            margin-bottom: 15px;
-            border-radius: 5px;
-            border: none;
-            background-color: #4CAF50;
-            color: white;
-            cursor: pointer;
-        }
-    }
-
-</style>
 <body>
-    <h1>Hello, Plant!</h1> )rawliteral";
-    webpage += "<p>Your sensor id: " + String(data.sensorId) + "</p>";
-    webpage += "<p>Current Temperature: " + String(data.temperature) + " &deg;C</p>";
-    webpage += "<p >Humidity percentage: " + String(data.percentage) + " %</p>";
-    webpage += "<p>Visible Light: " + String(data.light) + "</p>";
-    webpage += R"rawliteral(
+    <h1>Hello, Plant!</h1>
+)rawliteral";
+
+static const char dataPageForm[] PROGMEM = R"rawliteral(
     <p>Click on the button below to change the WiFi configuration:</p>
-   
-    <form id="reconfigForm" action="/reconfigure" method="post">
+    <form id="reconfigForm" action="/reconfigure" method="post" data-next=")rawliteral";
+
+static const char dataPageTail[] PROGMEM = R"rawliteral(">
         <button type="button" onclick="submitFormAndRedirect()">Changer la configuration Wi-Fi</button>
     </form>
+</body>
+</html>
+)rawliteral";
 
-    <script>
-        function submitFormAndRedirect() {
-            // Submit the form
-            document.getElementById('reconfigForm').submit();
-            
-            // Wait a moment before redirecting to allow form submission
-            setTimeout(function() {
-                window.location.href = ')rawliteral" + IP + R"rawliteral(';}, 3000); // Adjust the timeout as necessary
+/**
+ * @brief Static file of the web interface at a path
+ * @return nullptr when no file has this path
+ */
+inline const WebAsset *findWebAsset(const char *path)
+{
+    for (size_t i = 0; i < sizeof(webAssets) / sizeof(webAssets[0]); i++)
+    {
+        if (strcmp(webAssets[i].path, path) == 0)
+        {
+            return &webAssets[i];
         }
-    </script>
+    }
+    return nullptr;
+}
 
+/**
+ * @brief Writes a static file, gzip-encoded when the client accepts it. A client that has the
+ *        current version in its cache (If-None-Match) gets 304 and no body; Cache-Control makes the
+ *        browser ask every time, so a new firmware is seen at once.
+ * @param out Where the response is written, usually a PageWriter around the client
+ * @param asset The file
+ * @param request The request, for its Accept-Encoding and If-None-Match headers
+ */
+void writeWebAsset(Print &out, const WebAsset &asset, const HttpRequest &request)
+{
+    bool gzip = request.acceptsGzip;
+    char etag[24];
+    snprintf(etag, sizeof(etag), "\"%s%s\"", asset.etag, gzip ? "-gz" : "");
 
-</body>
-</html>
-)rawliteral";
-    return webpage;
+    bool cached = strstr(request.ifNoneMatch, etag) != nullptr;
+    out.print(cached ? F("HTTP/1.1 304 Not Modified\r\n") : F("HTTP/1.1 200 OK\r\n"));
+    out.print(F("ETag: "));
+    out.print(etag);
+    out.print(F("\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\nConnection: close\r\n"));
+    if (cached)
+    {
+        out.print(F("\r\n"));
+        return;
+    }
+    out.print(F("Content-Type: "));
+    out.print(asset.contentType);
+    if (gzip)
+    {
+        out.print(F("\r\nContent-Encoding: gzip"));
+    }
+    out.print(F("\r\nContent-Length: "));
+    out.print((unsigned long)(gzip ? asset.gzipSize : asset.plainSize));
+    out.print(F("\r\n\r\n"));
+    out.write(gzip ? asset.gzip : asset.plain, gzip ? asset.gzipSize : asset.plainSize);
+}
+
+/**
+ * @brief Writes the configuration page to connect to a WiFi network
+ * @param out Where the page is written, usually a PageWriter around the client
+ * @param networks The networks found by the last scan, strongest first
+ * @param passwordFailed Whether the password entered was incorrect
+ */
+void writeConfigPage(Print &out, const NetworkScanner &networks, bool passwordFailed)
+{
+    out.print(configPageHead);
+    for (size_t i = 0; i < networks.size(); i++)
+    {
+        const ScannedNetwork &network = networks[i];
+        out.print(F("<option value=\""));
+        writeHtmlEscaped(out, network.ssid);
+        out.print(F("\">"));
+        writeHtmlEscaped(out, network.ssid);
+        out.print(F(" ("));
+        out.print(network.rssi);
+        out.print(network.encryption == ENC_TYPE_NONE ? F(" dBm, open)") : F(" dBm)"));
+        out.print(F("</option>"));
+    }
+    if (networks.size() == 0 && !networks.isScanning())
+    {
+        out.print(F("<option value=\"\">No networks found</option>"));
+    }
+    out.print(configPageForm);
+    if (networks.isScanning())
+    {
+        out.print(configPageScanning);
+    }
+    if (passwordFailed)
+    {
+        out.print(configPageFailed);
+    }
+    out.print(pageTail);
+}
+
+/**
+ * @brief Writes the connecting page to be displayed while the arduino is connecting to the WiFi network
+ * @param out Where the page is written, usually a PageWriter around the client
+ * @param IP The IP address of the arduino
+ */
+void writeConnectingPage(Print &out, const String &IP)
+{
+    out.print(connectingPageHead);
+    out.print(IP);
+    out.print(connectingPageTail);
+}
+
+/**
+ * @brief Writes the data page to display the sensor data
+ * @param out Where the page is written, usually a PageWriter around the client
+ * @param IP The IP address of the arduino
+ * @param data The sensor datas to be displayed
+ */
+void writeDataPage(Print &out, const String &IP, const sensorData &data)
+{
+    out.print(dataPageHead);
+    out.print(F("    <p>Your sensor id: "));
+    out.print(data.sensorId);
+    out.print(F("</p>\n"));
+    for (size_t i = 0; i < SENSOR_FIELD_COUNT; i++)
+    {
+        const SensorField &field = ActiveSensorKit::field(i);
+        if (field.label)
+        {
+            // The id lets the page replace the value when a reading event comes
+            out.print(F("    <p>"));
+            out.print(field.label);
+            out.print(F(": <span id=\""));
+            out.print(field.key);
+            out.print(F("\">"));
+            out.print(FixedText(data.values[i], field.scale).text);
+            out.print(F("</span>"));
+            out.print(field.unit);
+            out.print(F("</p>\n"));
+        }
+    }
+    out.print(dataPageForm);
+    out.print(IP);
+    out.print(dataPageTail);
+}
+
+/**
+ * @brief Formats the data of a "reading" event: the fields shown on the data page, as text so the
+ *        page displays them like it renders them, e.g. {"sequence":12,"temperature":"21.50",...}
+ * @param buffer Destination, terminated
+ * @param size Size of the destination
+ * @param data The reading
+ * @param sequence Number of the reading since boot
+ * @return false when the destination is too small
+ */
+bool formatReadingEvent(char *buffer, size_t size, const sensorData &data, uint32_t sequence)
+{
+    size_t length = snprintf(buffer, size, "{\"sequence\":%lu", (unsigned long)sequence);
+    for (size_t i = 0; i < SENSOR_FIELD_COUNT && length < size; i++)
+    {
+        const SensorField &field = ActiveSensorKit::field(i);
+        if (field.label)
+        {
+            length += snprintf(buffer + length, size - length, ",\"%s\":\"%s\"", field.key,
+                               FixedText(data.values[i], field.scale).text);
+        }
+    }
+    if (length + 1 >= size)
+    {
+        return false;
+    }
+    buffer[length++] = '}';
+    buffer[length] = '\0';
+    return true;
 }
 #endif
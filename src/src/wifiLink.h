@@ -0,0 +1,349 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  wifiLink.h
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Non-blocking connection to the configured WiFi network. WiFi.begin() only starts the
+ *        association and the status is polled from loop(); failed attempts are retried with an
+ *        exponential backoff and random jitter, so a fleet does not hammer a rebooting router in
+ *        step. Credentials are only reported as wrong when the network really rejects them.
+ *        The last DHCP lease is reused as a static address to reconnect faster, until it is
+ *        WIFI_LEASE_MAX_AGE old or an upload on it gets no answer.
+ *
+ */
+
+#ifndef WIFILINK_H
+#define WIFILINK_H
+
+#include <Arduino.h>
+#include <WiFiNINA.h>
+
+// Time an association may take before the attempt is counted as failed
+#ifndef WIFI_CONNECT_TIMEOUT
+#define WIFI_CONNECT_TIMEOUT 15000
+#endif
+// Backoff before the second attempt, doubled after every failure up to WIFI_BACKOFF_MAX
+#ifndef WIFI_BACKOFF_BASE
+#define WIFI_BACKOFF_BASE 1000
+#endif
+#ifndef WIFI_BACKOFF_MAX
+#define WIFI_BACKOFF_MAX 300000
+#endif
+// Failed attempts after which credentials that never worked are reported as wrong
+#ifndef WIFI_NEW_CREDENTIALS_ATTEMPTS
+#define WIFI_NEW_CREDENTIALS_ATTEMPTS 5
+#endif
+// Authentication failures in a row after which credentials that used to work are reported as wrong
+#ifndef WIFI_AUTH_FAILURES
+#define WIFI_AUTH_FAILURES 5
+#endif
+// Age after which a DHCP lease is no longer reused as a static address, half of a common 24 h lease:
+// past its end the router may give the address to another host
+#ifndef WIFI_LEASE_MAX_AGE
+#define WIFI_LEASE_MAX_AGE 43200000UL
+#endif
+
+enum WiFiLinkState
+{
+    WIFI_LINK_STOPPED,
+    WIFI_LINK_CONNECTING,
+    WIFI_LINK_CONNECTED,
+    WIFI_LINK_BACKOFF
+};
+
+enum WiFiLinkEvent
+{
+    WIFI_LINK_NONE,
+    WIFI_LINK_UP,
+    WIFI_LINK_LOST,
+    WIFI_LINK_REJECTED
+};
+
+/**
+ * @brief Counters describing the WiFi link since boot
+ */
+struct WiFiLinkStats
+{
+    uint32_t connections;
+    uint32_t attempts;
+    uint32_t failedAttempts;
+    uint32_t losses;
+    unsigned long lastReconnectMs;   // From the start of the first attempt (or the loss) to the connection
+    unsigned long maxReconnectMs;
+    uint64_t totalReconnectMs;
+    uint8_t lastAttempts;            // Attempts needed by the last connection
+};
+
+class WiFiLink
+{
+public:
+    WiFiLink()
+        : ssid(nullptr), pass(nullptr), linkState(WIFI_LINK_STOPPED), proven(false), hasLease(false),
+          leaseApplied(false), leaseObtained(0), failures(0), authFailures(0), attemptStart(0), outageStart(0),
+          nextAttempt(0), lastPoll(0), stats()
+    {
+    }
+
+    /**
+     * @brief Starts connecting with new credentials, the cached address of the previous network is
+     *        forgotten
+     * @param known true if the credentials already worked, e.g. loaded from flash. Only their
+     *        rejection by the network is then reported, not an unreachable network.
+     */
+    void begin(const char *newSsid, const char *newPass, bool known = false)
+    {
+        ssid = newSsid;
+        pass = newPass;
+        proven = known;
+        forgetLease();
+        reconnect();
+    }
+
+    /**
+     * @brief Starts a new attempt right away with the current credentials
+     */
+    void reconnect()
+    {
+        failures = 0;
+        authFailures = 0;
+        outageStart = millis();
+        startAttempt();
+    }
+
+    /**
+     * @brief Powers the WiFi module down, the link stays down until begin() or reconnect()
+     */
+    void stop()
+    {
+        WiFi.end();
+        leaseApplied = false;
+        linkState = WIFI_LINK_STOPPED;
+    }
+
+    /**
+     * @brief Follows the association, to be called often from loop(). Costs one status query of the
+     *        WiFi module at most every 100 ms while connecting, every second while connected.
+     * @return What changed since the previous call
+     */
+    WiFiLinkEvent poll()
+    {
+        unsigned long now = millis();
+        switch (linkState)
+        {
+        case WIFI_LINK_CONNECTING:
+        {
+            if (now - lastPoll < 100)
+            {
+                return WIFI_LINK_NONE;
+            }
+            lastPoll = now;
+            uint8_t status = WiFi.status();
+            if (status == WL_CONNECTED)
+            {
+                return connected(now);
+            }
+            // The module reports the other states transiently while it associates
+            if (status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL || now - attemptStart >= WIFI_CONNECT_TIMEOUT)
+            {
+                return failed(status == WL_CONNECT_FAILED);
+            }
+            return WIFI_LINK_NONE;
+        }
+        case WIFI_LINK_CONNECTED:
+            if (now - lastPoll < 1000)
+            {
+                return WIFI_LINK_NONE;
+            }
+            lastPoll = now;
+            if (WiFi.status() != WL_CONNECTED)
+            {
+                stats.losses++;
+                outageStart = now;
+                failures = 0;
+                authFailures = 0;
+                startAttempt();
+                return WIFI_LINK_LOST;
+            }
+            return WIFI_LINK_NONE;
+        case WIFI_LINK_BACKOFF:
+            if ((long)(now - nextAttempt) >= 0)
+            {
+                startAttempt();
+            }
+            return WIFI_LINK_NONE;
+        default:
+            return WIFI_LINK_NONE;
+        }
+    }
+
+    /**
+     * @brief Reports an upload that got no answer. On the cached lease the address may have been given
+     *        to another host since: the link reconnects with DHCP.
+     * @return true if the link went down for that
+     */
+    bool uploadFailed()
+    {
+        if (linkState != WIFI_LINK_CONNECTED || !leaseApplied)
+        {
+            return false;
+        }
+        forgetLease();
+        reconnect();
+        return true;
+    }
+
+    /**
+     * @brief Counts a deep sleep in the age of the lease, millis() stops meanwhile
+     */
+    void advance(unsigned long ms)
+    {
+        leaseObtained -= ms;
+    }
+
+    WiFiLinkState state() const
+    {
+        return linkState;
+    }
+
+    /**
+     * @brief Time before the next attempt while backing off
+     */
+    unsigned long backoffRemaining() const
+    {
+        long remaining = (long)(nextAttempt - millis());
+        return linkState == WIFI_LINK_BACKOFF && remaining > 0 ? (unsigned long)remaining : 0;
+    }
+
+    const WiFiLinkStats &getStats() const
+    {
+        return stats;
+    }
+
+private:
+    void startAttempt()
+    {
+        if (hasLease && millis() - leaseObtained >= WIFI_LEASE_MAX_AGE)
+        {
+            forgetLease();
+        }
+        // The address of the last DHCP lease is set statically, the association then skips DHCP
+        WiFi.disconnect();
+        if (hasLease)
+        {
+            WiFi.config(leaseIp, leaseGateway, leaseGateway, leaseSubnet);
+            leaseApplied = true;
+        }
+        // With no timeout WiFi.begin() returns as soon as the module started the association
+        WiFi.setTimeout(0);
+        WiFi.begin(ssid, pass);
+        stats.attempts++;
+        attemptStart = millis();
+        lastPoll = attemptStart;
+        linkState = WIFI_LINK_CONNECTING;
+    }
+
+    WiFiLinkEvent connected(unsigned long now)
+    {
+        linkState = WIFI_LINK_CONNECTED;
+        proven = true;
+        // Only a DHCP exchange renews the lease, a connection on the cached address does not
+        if (!leaseApplied)
+        {
+            hasLease = true;
+            leaseObtained = now;
+            leaseIp = WiFi.localIP();
+            leaseGateway = WiFi.gatewayIP();
+            leaseSubnet = WiFi.subnetMask();
+        }
+
+        unsigned long duration = now - outageStart;
+        stats.connections++;
+        stats.lastAttempts = (uint8_t)(failures + 1);
+        stats.lastReconnectMs = duration;
+        stats.totalReconnectMs += duration;
+        if (duration > stats.maxReconnectMs)
+        {
+            stats.maxReconnectMs = duration;
+        }
+        failures = 0;
+        authFailures = 0;
+        return WIFI_LINK_UP;
+    }
+
+    WiFiLinkEvent failed(bool rejected)
+    {
+        WiFi.disconnect();
+        stats.failedAttempts++;
+        if (failures < 255)
+        {
+            failures++;
+        }
+        authFailures = rejected ? authFailures + 1 : 0;
+        // A static address from an old lease may be refused by the network, ask DHCP next time
+        forgetLease();
+
+        if ((!proven && failures >= WIFI_NEW_CREDENTIALS_ATTEMPTS) || authFailures >= WIFI_AUTH_FAILURES)
+        {
+            linkState = WIFI_LINK_STOPPED;
+            return WIFI_LINK_REJECTED;
+        }
+
+        unsigned long backoff = WIFI_BACKOFF_BASE;
+        for (uint8_t i = 1; i < failures && backoff < WIFI_BACKOFF_MAX; i++)
+        {
+            backoff *= 2;
+        }
+        if (backoff > WIFI_BACKOFF_MAX)
+        {
+            backoff = WIFI_BACKOFF_MAX;
+        }
+        // Half of the backoff is fixed, the other half is random (seeded per board and boot in setup())
+        nextAttempt = millis() + backoff / 2 + (unsigned long)random((long)(backoff / 2 + 1));
+        linkState = WIFI_LINK_BACKOFF;
+        return WIFI_LINK_NONE;
+    }
+
+    /**
+     * @brief Goes back to DHCP for the next attempt. The NINA module keeps an address set by
+     *        WiFi.config() until it is powered down, WiFi.disconnect() does not clear it.
+     */
+    void forgetLease()
+    {
+        hasLease = false;
+        if (leaseApplied)
+        {
+            WiFi.end();
+            leaseApplied = false;
+        }
+    }
+
+    const char *ssid;
+    const char *pass;
+    WiFiLinkState linkState;
+    bool proven;
+    bool hasLease;
+    // WiFi.config() was given the lease since the module was last powered down
+    bool leaseApplied;
+    // millis() when DHCP gave the lease, deep sleep included
+    unsigned long leaseObtained;
+    IPAddress leaseIp;
+    IPAddress leaseGateway;
+    IPAddress leaseSubnet;
+    uint8_t failures;
+    uint8_t authFailures;
+    unsigned long attemptStart;
+    unsigned long outageStart;
+    unsigned long nextAttempt;
+    unsigned long lastPoll;
+    WiFiLinkStats stats;
+};
+
+#endif
@@ -0,0 +1,283 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  test_main.cpp
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Host tests of formParser.h, run with `pio test -e native`. Random bodies are fed to
+ *        FormParser in random pieces and compared with a plain decoder of the whole body, then the
+ *        configuration form is timed.
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unity.h>
+#include "../../src/formParser.h"
+
+// Random bodies compared with the reference decoder
+#ifndef FORM_FUZZ_RUNS
+#define FORM_FUZZ_RUNS 100000
+#endif
+// Parses of the configuration form timed
+#ifndef FORM_BENCHMARK_RUNS
+#define FORM_BENCHMARK_RUNS 100000
+#endif
+
+namespace
+{
+
+/**
+ * @brief What the parser should give for one field
+ */
+struct ExpectedField
+{
+    std::string value;
+    bool found;
+    bool truncated;
+};
+
+int hexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/**
+ * @brief Percent-decodes a complete name or value, an invalid escape is kept as text
+ */
+std::string decode(const std::string &text)
+{
+    std::string out;
+    for (size_t i = 0; i < text.size(); i++)
+    {
+        if (text[i] == '%' && i + 2 < text.size() && hexValue(text[i + 1]) >= 0 && hexValue(text[i + 2]) >= 0)
+        {
+            out += (char)(hexValue(text[i + 1]) << 4 | hexValue(text[i + 2]));
+            i += 2;
+        }
+        else
+        {
+            out += text[i] == '+' ? ' ' : text[i];
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Decodes a whole body the simple way: split on "&", then on the first "="
+ */
+void referenceParse(const std::string &body, const FormField *fields, size_t count, ExpectedField *expected)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        expected[i] = ExpectedField{"", false, false};
+    }
+    size_t start = 0;
+    while (start <= body.size())
+    {
+        size_t end = body.find('&', start);
+        if (end == std::string::npos)
+        {
+            end = body.size();
+        }
+        std::string pair = body.substr(start, end - start);
+        start = end + 1;
+
+        size_t equals = pair.find('=');
+        std::string name = decode(pair.substr(0, equals));
+        if (name.empty() || name.size() > FORM_MAX_NAME)
+        {
+            continue;
+        }
+        std::string value = equals == std::string::npos ? "" : decode(pair.substr(equals + 1));
+        for (size_t i = 0; i < count; i++)
+        {
+            if (name != fields[i].name)
+            {
+                continue;
+            }
+            ExpectedField &field = expected[i];
+            field = ExpectedField{"", true, false};
+            for (char c : value)
+            {
+                if (c == '\0' || field.value.size() + 1 >= fields[i].size)
+                {
+                    field.truncated = true;
+                }
+                else
+                {
+                    field.value += c;
+                }
+            }
+        }
+    }
+}
+
+std::string randomBody(std::mt19937 &random)
+{
+    // Pieces that make up forms, escapes and the cases around them
+    static const char *const pieces[] = {"ssid", "pass", "id", "=", "=", "&", "&", "+", "%", "%2", "%26", "%3D",
+                                         "%2B", "%00", "%C3%A9", "%zz", "%4", "a", "b", "Lab", " ", "%41",
+                                         "averyveryverylongname"};
+    std::uniform_int_distribution<size_t> pieceCount(0, 24);
+    std::uniform_int_distribution<size_t> pick(0, sizeof(pieces) / sizeof(pieces[0]) - 1);
+    std::string body;
+    for (size_t n = pieceCount(random); n > 0; n--)
+    {
+        body += pieces[pick(random)];
+    }
+    return body;
+}
+
+} // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_config_form_with_the_longest_credentials()
+{
+    // 32 bytes of UTF-8 and 63 characters that all need an escape, about 310 bytes encoded
+    std::string body = "ssid=";
+    for (int i = 0; i < 16; i++)
+    {
+        body += "%C3%A9";
+    }
+    body += "&pass=";
+    for (int i = 0; i < 63; i++)
+    {
+        body += i % 2 ? "%26" : "%3D";
+    }
+    body += "&idsensor=42";
+
+    char ssid[33];
+    char pass[64];
+    char id[8];
+    FormField fields[] = {FORM_FIELD("ssid", ssid), FORM_FIELD("pass", pass), FORM_FIELD("idsensor", id)};
+    FormParser parser(fields, 3);
+    // A byte at a time, as a slow client would send it
+    for (char c : body)
+    {
+        parser.feed(c);
+    }
+    parser.finish();
+
+    TEST_ASSERT_EQUAL_UINT(32, strlen(ssid));
+    TEST_ASSERT_EQUAL_UINT(63, strlen(pass));
+    TEST_ASSERT_EQUAL_STRING("=&=&", std::string(pass, 4).c_str());
+    TEST_ASSERT_EQUAL_STRING("42", id);
+    for (const FormField &field : fields)
+    {
+        TEST_ASSERT_TRUE(field.found);
+        TEST_ASSERT_FALSE(field.truncated);
+    }
+}
+
+void test_value_too_long_is_cut_and_flagged()
+{
+    char id[4];
+    FormField fields[] = {FORM_FIELD("idsensor", id)};
+    parseForm("idsensor=12345", 14, fields, 1);
+    TEST_ASSERT_EQUAL_STRING("123", id);
+    TEST_ASSERT_TRUE(fields[0].truncated);
+}
+
+void test_missing_field_is_empty()
+{
+    char ssid[8];
+    char pass[8];
+    FormField fields[] = {FORM_FIELD("ssid", ssid), FORM_FIELD("pass", pass)};
+    parseForm("ssid=Lab&other=1", 16, fields, 2);
+    TEST_ASSERT_EQUAL_STRING("Lab", ssid);
+    TEST_ASSERT_FALSE(fields[1].found);
+    TEST_ASSERT_EQUAL_STRING("", pass);
+}
+
+void test_random_bodies_in_random_pieces_match_the_reference()
+{
+    std::mt19937 random(20261018);
+    char ssid[6];
+    char pass[3];
+    char id[1];
+    FormField fields[] = {FORM_FIELD("ssid", ssid), FORM_FIELD("pass", pass), FORM_FIELD("id", id)};
+    const size_t count = sizeof(fields) / sizeof(fields[0]);
+
+    for (long run = 0; run < FORM_FUZZ_RUNS; run++)
+    {
+        std::string body = randomBody(random);
+        ExpectedField expected[count];
+        referenceParse(body, fields, count, expected);
+
+        FormParser parser(fields, count);
+        size_t at = 0;
+        while (at < body.size())
+        {
+            size_t piece = std::uniform_int_distribution<size_t>(1, body.size() - at)(random);
+            parser.feed(body.data() + at, piece);
+            at += piece;
+        }
+        parser.finish();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (fields[i].found != expected[i].found || fields[i].truncated != expected[i].truncated ||
+                expected[i].value != fields[i].value)
+            {
+                std::printf("body \"%s\", field %s: got \"%s\" (found %d, truncated %d)\n", body.c_str(),
+                            fields[i].name, fields[i].value, fields[i].found, fields[i].truncated);
+                TEST_FAIL_MESSAGE("FormParser differs from the reference decoder");
+            }
+        }
+    }
+}
+
+void test_benchmark_config_form()
+{
+    const char body[] = "ssid=PlantKeeper+Lab+%26+Co&pass=correct%20horse%20battery%20staple&idsensor=42";
+    char ssid[33];
+    char pass[64];
+    char id[8];
+    FormField fields[] = {FORM_FIELD("ssid", ssid), FORM_FIELD("pass", pass), FORM_FIELD("idsensor", id)};
+
+    auto start = std::chrono::steady_clock::now();
+    for (long run = 0; run < FORM_BENCHMARK_RUNS; run++)
+    {
+        parseForm(body, sizeof(body) - 1, fields, 3);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::printf("parseForm: %.0f ns per %u-byte body on this host\n", ns / FORM_BENCHMARK_RUNS,
+                (unsigned)(sizeof(body) - 1));
+    TEST_ASSERT_EQUAL_STRING("correct horse battery staple", pass);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_config_form_with_the_longest_credentials);
+    RUN_TEST(test_value_too_long_is_cut_and_flagged);
+    RUN_TEST(test_missing_field_is_empty);
+    RUN_TEST(test_random_bodies_in_random_pieces_match_the_reference);
+    RUN_TEST(test_benchmark_config_form);
+    return UNITY_END();
+}
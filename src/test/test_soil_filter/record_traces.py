@@ -0,0 +1,86 @@
+"""
+Writes traces.h, the soil probe traces replayed by test_main.cpp.
+
+Each sample is made the way lib/NativeHAL makes the results of the free-running ADC: the sum of
+4 conversions of the probe, each the soil level plus up to 25 of noise, or a spike anywhere in the
+10-bit range. The true level (4 times the soil level) is kept next to each sample. Run it again
+after a change of the model: python3 record_traces.py > traces.h
+"""
+
+import random
+
+random.seed(20261018)
+
+
+def record(length, level_at, spike_percent, burst_percent=0):
+    samples, truth = [], []
+    burst = 0
+    for i in range(length):
+        level = level_at(i)
+        if burst == 0 and random.randrange(100) < burst_percent:
+            # A bad contact lasting a few conversions
+            burst = random.randint(2, 8)
+        total = 0
+        for _ in range(4):
+            if burst > 0 or random.randrange(100) < spike_percent:
+                total += random.randrange(1024)
+                burst = max(burst - 1, 0)
+            else:
+                total += min(max(level + random.randint(-25, 25), 0), 1023)
+        samples.append(total)
+        truth.append(4 * level)
+    return samples, truth
+
+
+def walk(start):
+    state = {"level": start}
+
+    def level_at(i):
+        if random.randrange(75) == 0:
+            state["level"] = min(max(state["level"] + random.randint(-2, 2), 700), 1023)
+        return state["level"]
+
+    return level_at
+
+
+TRACES = [
+    ("steady", "soil left alone, 5 % of the conversions are spikes", record(600, walk(860), 5)),
+    ("watering", "dry soil watered after 200 samples, 5 % of spikes",
+     record(600, lambda i: 1000 if i < 200 else 720, 5)),
+    ("badContact", "2 % of spikes and bursts of 2 to 8 bad conversions", record(600, walk(900), 2, 2)),
+]
+
+
+def array(name, values):
+    lines = []
+    for start in range(0, len(values), 16):
+        lines.append("    " + ", ".join(str(v) for v in values[start:start + 16]) + ",")
+    return "const uint16_t %s[] = {\n%s\n};\n" % (name, "\n".join(lines))
+
+
+print("// Written by record_traces.py, do not edit")
+print("#ifndef SOIL_TRACES_H")
+print("#define SOIL_TRACES_H")
+print()
+print("#include <stddef.h>")
+print("#include <stdint.h>")
+print()
+for name, description, (samples, truth) in TRACES:
+    print("// %s: %s" % (name, description))
+    print(array(name + "Samples", samples))
+    print(array(name + "Truth", truth))
+print("struct SoilTrace")
+print("{")
+print("    const char *name;")
+print("    const uint16_t *samples;")
+print("    // 4 times the soil level, on the scale of the samples")
+print("    const uint16_t *truth;")
+print("    size_t length;")
+print("};")
+print()
+print("const SoilTrace soilTraces[] = {")
+for name, _, (samples, _) in TRACES:
+    print('    {"%s", %sSamples, %sTruth, %d},' % (name, name, name, len(samples)))
+print("};")
+print()
+print("#endif")
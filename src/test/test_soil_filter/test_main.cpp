@@ -0,0 +1,181 @@
+/**
+ * Project Name: PlantKeeper
+ *
+ * @created 18.10.2026
+ * @file  test_main.cpp
+ * @version 1.0.0
+ * @see https://github.com/Plant-keeper
+ *
+ * @authors
+ *   - Rafael Dousse
+ *   - Eva Ray
+ *   - Quentin Surdez
+ *   - Rachel Tranchida
+ * @brief Host tests of soilFilter.h, run with `pio test -e native`. The simulated probe traces of
+ *        traces.h are replayed through SoilFilter and its output is compared with the true level.
+ *
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <unity.h>
+#include "../../src/soilFilter.h"
+#include "traces.h"
+
+// Samples left to the filter to settle before it is compared with the truth
+#define SETTLE_SAMPLES 100
+// 1 % of the 12-bit scale of the samples
+#define ONE_PERCENT 41
+// Sample of the watering trace at which the level drops
+#define WATERING_STEP 200
+
+namespace
+{
+
+/**
+ * @brief What a trace gave through the filter, errors against the truth after SETTLE_SAMPLES
+ */
+struct Replay
+{
+    double rawRms;
+    double filteredRms;
+    int filteredMax;
+    // Samples further than twice the outlier limit from the truth, and those the filter let through
+    int spikes;
+    int missedSpikes;
+};
+
+/**
+ * @brief Replays a trace through a new filter
+ * @param skipFrom, skipTo Samples left out of the errors, e.g. while the filter follows a step
+ */
+Replay replay(const SoilTrace &trace, size_t skipFrom = 0, size_t skipTo = 0)
+{
+    Replay result = {0, 0, 0, 0, 0};
+    SoilFilter filter;
+    double rawSquares = 0;
+    double filteredSquares = 0;
+    for (size_t i = 0; i < trace.length; i++)
+    {
+        uint32_t rejected = filter.rejected();
+        filter.add(trace.samples[i]);
+
+        int rawError = abs((int)trace.samples[i] - (int)trace.truth[i]);
+        if (rawError > 2 * SOIL_OUTLIER_LIMIT)
+        {
+            result.spikes++;
+            if (filter.rejected() == rejected)
+            {
+                result.missedSpikes++;
+            }
+        }
+        if (i < SETTLE_SAMPLES || (i >= skipFrom && i < skipTo))
+        {
+            continue;
+        }
+        int filteredError = abs((int)filter.value() - (int)trace.truth[i]);
+        rawSquares += (double)rawError * rawError;
+        filteredSquares += (double)filteredError * filteredError;
+        if (filteredError > result.filteredMax)
+        {
+            result.filteredMax = filteredError;
+        }
+    }
+    size_t compared = trace.length - SETTLE_SAMPLES - (skipTo > skipFrom ? skipTo - skipFrom : 0);
+    result.rawRms = std::sqrt(rawSquares / compared);
+    result.filteredRms = std::sqrt(filteredSquares / compared);
+    std::printf("%s: RMS error %.1f raw, %.1f filtered, max %d; %d spikes, %d let through\n", trace.name,
+                result.rawRms, result.filteredRms, result.filteredMax, result.spikes, result.missedSpikes);
+    return result;
+}
+
+/**
+ * @brief Samples the filter needs to come within a tolerance of a step of the level: the median
+ *        sides with the new level once it holds most of the window, then the average closes
+ *        1/2^SOIL_EMA_SHIFT of the gap per sample, computed like the filter does
+ */
+size_t stepLatency(int32_t step, int32_t tolerance)
+{
+    size_t samples = SOIL_MEDIAN_WINDOW / 2;
+    int32_t gap = abs(step) << SOIL_EMA_FRACTION;
+    while (gap > tolerance << SOIL_EMA_FRACTION)
+    {
+        gap -= gap >> SOIL_EMA_SHIFT;
+        samples++;
+    }
+    return samples;
+}
+
+void checkErrors(const Replay &result)
+{
+    TEST_ASSERT_LESS_THAN_INT((int)result.rawRms, (int)result.filteredRms);
+    TEST_ASSERT_LESS_THAN_INT(result.spikes / 10 + 1, result.missedSpikes);
+}
+
+void checkSteadyTrace(const SoilTrace &trace)
+{
+    Replay result = replay(trace);
+    checkErrors(result);
+    TEST_ASSERT_LESS_THAN_INT(ONE_PERCENT, (int)result.filteredRms);
+    TEST_ASSERT_LESS_THAN_INT((int)result.rawRms / 5, (int)result.filteredRms);
+    TEST_ASSERT_LESS_THAN_INT(SOIL_OUTLIER_LIMIT, result.filteredMax);
+}
+
+} // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_steady_soil_with_spikes()
+{
+    checkSteadyTrace(soilTraces[0]);
+}
+
+void test_bad_contact_bursts()
+{
+    checkSteadyTrace(soilTraces[2]);
+}
+
+void test_watering_goes_through()
+{
+    const SoilTrace &trace = soilTraces[1];
+    size_t latency = stepLatency((int32_t)trace.truth[WATERING_STEP] - trace.truth[WATERING_STEP - 1], ONE_PERCENT);
+    std::printf("watering: within 1 %% after %u samples at most\n", (unsigned)latency);
+
+    // Away from the step the filter does better than the raw samples, like on the other traces
+    Replay result = replay(trace, WATERING_STEP, WATERING_STEP + latency);
+    checkErrors(result);
+    TEST_ASSERT_LESS_THAN_INT(result.rawRms / 5, (int)result.filteredRms);
+
+    // The spikes do not slow the filter down: it follows the step as fast as a clean one allows
+    SoilFilter filter;
+    for (size_t i = 0; i < trace.length; i++)
+    {
+        filter.add(trace.samples[i]);
+        if (i >= WATERING_STEP + latency)
+        {
+            TEST_ASSERT_INT_WITHIN(ONE_PERCENT, trace.truth[i], filter.value());
+        }
+    }
+}
+
+void test_first_sample_sets_the_value()
+{
+    SoilFilter filter;
+    TEST_ASSERT_FALSE(filter.ready());
+    filter.add(3000);
+    TEST_ASSERT_TRUE(filter.ready());
+    TEST_ASSERT_EQUAL_INT(3000, filter.value());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_steady_soil_with_spikes);
+    RUN_TEST(test_bad_contact_bursts);
+    RUN_TEST(test_watering_goes_through);
+    RUN_TEST(test_first_sample_sets_the_value);
+    return UNITY_END();
+}
@@ -0,0 +1,272 @@
+// Written by record_traces.py, do not edit
+#ifndef SOIL_TRACES_H
+#define SOIL_TRACES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// steady: soil left alone, 5 % of the conversions are spikes
+const uint16_t steadySamples[] = {
+    3440, 3404, 3435, 2784, 3394, 3401, 3457, 3427, 2575, 3432, 3437, 3408, 3019, 3437, 3454, 3377,
+    3467, 3437, 3463, 3466, 3473, 3420, 3048, 3089, 3432, 3533, 3442, 3415, 3594, 3408, 3439, 3448,
+    3400, 3478, 2912, 3426, 3200, 3460, 3461, 3421, 3391, 3431, 2695, 2985, 1877, 3448, 3426, 3460,
+    3416, 3280, 3435, 2606, 3442, 3489, 3466, 3478, 3410, 3476, 2763, 3448, 3462, 3476, 3427, 3408,
+    3420, 3405, 3478, 3173, 3454, 3385, 3192, 3285, 3405, 3414, 3437, 3423, 3415, 3414, 2996, 3471,
+    3376, 3349, 3473, 3074, 3422, 3393, 3429, 3448, 3418, 3435, 2643, 3408, 3443, 3446, 3412, 3450,
+    3429, 3422, 3457, 3397, 3419, 3562, 3387, 3432, 3448, 3463, 3437, 2600, 3294, 3425, 3404, 3377,
+    3454, 3404, 3405, 3374, 3438, 3391, 3421, 3367, 3459, 3409, 3433, 3392, 3431, 3412, 3398, 3467,
+    2684, 3421, 3435, 3430, 3462, 3364, 3402, 3463, 3416, 3416, 3462, 3396, 3434, 2828, 3376, 3401,
+    3402, 3385, 3403, 3425, 3385, 2925, 3449, 3337, 2637, 3450, 3452, 3445, 3401, 3387, 3453, 3415,
+    3415, 3435, 3430, 3394, 3358, 3407, 3402, 3565, 3430, 3441, 3436, 3436, 3461, 3431, 3409, 3418,
+    3601, 3432, 3451, 3373, 3397, 3396, 3433, 3437, 3402, 3490, 3449, 3470, 3430, 3469, 3333, 3408,
+    3495, 3421, 2940, 3387, 2874, 3371, 3123, 3394, 3399, 2832, 3259, 3454, 3454, 2975, 3463, 2500,
+    2617, 3383, 3444, 3420, 3408, 3433, 3391, 3485, 2660, 3434, 3394, 3450, 3441, 3367, 3428, 3440,
+    3415, 3424, 3447, 3420, 3474, 3451, 3422, 3426, 3466, 3462, 3221, 3411, 3400, 3418, 2803, 3445,
+    3454, 2761, 3408, 3181, 3396, 2641, 3416, 3449, 3490, 3444, 3381, 3360, 3417, 3498, 3452, 3433,
+    3060, 3364, 3460, 2899, 3491, 3455, 2901, 3436, 3431, 3428, 3432, 3433, 3495, 3411, 3435, 2886,
+    3472, 3414, 3490, 3413, 3352, 2970, 3455, 3418, 3441, 3477, 3401, 3486, 3496, 3453, 3126, 3409,
+    3465, 3416, 3429, 3194, 3462, 3419, 3578, 3439, 3448, 3440, 3455, 3555, 3228, 3442, 3429, 3469,
+    2667, 3286, 3388, 2660, 3458, 3405, 3424, 3517, 3458, 3474, 3430, 3481, 3433, 3277, 3412, 3463,
+    3451, 3448, 3143, 3443, 3366, 3430, 3445, 3452, 3465, 3455, 3487, 3462, 3457, 3435, 3468, 3443,
+    3449, 3445, 3427, 3403, 3510, 3570, 3188, 3455, 2887, 3481, 3511, 3033, 3416, 3282, 3452, 2777,
+    3485, 3416, 3474, 3441, 3180, 3442, 3463, 3482, 3434, 3471, 3526, 3443, 3456, 2930, 3434, 3450,
+    3257, 3483, 3435, 3427, 3420, 3437, 3388, 3488, 3401, 3444, 3425, 3433, 3421, 3445, 2941, 3392,
+    3469, 3463, 3426, 3457, 3447, 3500, 3456, 3465, 3480, 3451, 3436, 3459, 3419, 3441, 3393, 2915,
+    3471, 3495, 3537, 3463, 2632, 3466, 3413, 3420, 3486, 3474, 3453, 3322, 3463, 3430, 3392, 3485,
+    3436, 3438, 3436, 3418, 3496, 3468, 3424, 3468, 3463, 2893, 3486, 3416, 3434, 3407, 3428, 3455,
+    3012, 3492, 3428, 3398, 3407, 3380, 3143, 3465, 3402, 3450, 3447, 3428, 3550, 3469, 3443, 3435,
+    3476, 3529, 3107, 3424, 3438, 3438, 3437, 3469, 3461, 3343, 3436, 3525, 3474, 3477, 3445, 3426,
+    3451, 3413, 3498, 3445, 3462, 3463, 3455, 2734, 3454, 3451, 3477, 3421, 3065, 3415, 3526, 2907,
+    3459, 3417, 3386, 3133, 3457, 3489, 3113, 3471, 3432, 3457, 3510, 3354, 3474, 3459, 3428, 3431,
+    3424, 3476, 3460, 3453, 3464, 3468, 3455, 3421, 3425, 3461, 3431, 3423, 3472, 3396, 3470, 3461,
+    3501, 3441, 3463, 3442, 3187, 3447, 3263, 3441, 3404, 3392, 3470, 3404, 3416, 3431, 3435, 3434,
+    3463, 3407, 3440, 3414, 2848, 3424, 3426, 3063, 3463, 3202, 3224, 3069, 3435, 3482, 3409, 3380,
+    3413, 3425, 3459, 3398, 3486, 3446, 3421, 3449, 3477, 3203, 3442, 3475, 3417, 3270, 3382, 3447,
+    3458, 3459, 3452, 2639, 3417, 3490, 3415, 3441, 3446, 3463, 3475, 3477, 3414, 3467, 2748, 3438,
+    2731, 3422, 3427, 2676, 3430, 3380, 3421, 3454, 3429, 3419, 3447, 3466, 3403, 3482, 3424, 3465,
+    3459, 3556, 3474, 3422, 2844, 3460, 3420, 3436,
+};
+
+const uint16_t steadyTruth[] = {
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3444, 3444, 3444, 3444, 3444, 3444,
+    3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3436, 3436, 3436, 3436, 3436,
+    3436, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
+    3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
+    3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
+    3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
+    3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
+    3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
+    3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
+    3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
+    3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
+    3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
+    3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
+    3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432,
+    3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
+    3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3440, 3440, 3440,
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
+    3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
+};
+
+// watering: dry soil watered after 200 samples, 5 % of spikes
+const uint16_t wateringSamples[] = {
+    4011, 3074, 3986, 4000, 3092, 3990, 4041, 3975, 4012, 3991, 3978, 3950, 4004, 4002, 3969, 4004,
+    4030, 3205, 4018, 3807, 3988, 4002, 3994, 3961, 3742, 3998, 3991, 3177, 4022, 3981, 4029, 4016,
+    3992, 3968, 3042, 3990, 3982, 3992, 3989, 4023, 4040, 4007, 3966, 3969, 4044, 4027, 3935, 3978,
+    4032, 3017, 3919, 4011, 4033, 3986, 3964, 3989, 4046, 3979, 4017, 4015, 3976, 3947, 4008, 4002,
+    3887, 3989, 3969, 3283, 3992, 4009, 4038, 2836, 4031, 3994, 3992, 3946, 3989, 3986, 4014, 3996,
+    3977, 4025, 4027, 3990, 3991, 4017, 3994, 3977, 4021, 3973, 4042, 3953, 4016, 3962, 4016, 3880,
+    3840, 4043, 3965, 4010, 3996, 4015, 4004, 3980, 4015, 4011, 3979, 3882, 3988, 3952, 4025, 4004,
+    4017, 3992, 4004, 4050, 4002, 3896, 4013, 3280, 4014, 4032, 4043, 2997, 4020, 3462, 4018, 3941,
+    4002, 3950, 4052, 3961, 3960, 3968, 4010, 3854, 3639, 3375, 3078, 3985, 3147, 3980, 3992, 3418,
+    3965, 3319, 4038, 4066, 4012, 3952, 4004, 4059, 3994, 3958, 4048, 4000, 3999, 3947, 3570, 3315,
+    3528, 4017, 4009, 3985, 4043, 4032, 4003, 3944, 4019, 4005, 3993, 3999, 3026, 3950, 4017, 3516,
+    4014, 4017, 3396, 3976, 3999, 3973, 4046, 3998, 4000, 4018, 4017, 3953, 3997, 3996, 4016, 3959,
+    4063, 3948, 4020, 4010, 4007, 3927, 3990, 3996, 2911, 2856, 2881, 2835, 2838, 2876, 2810, 3085,
+    3006, 2807, 2880, 2418, 2900, 2853, 2873, 2893, 2875, 1862, 2875, 2376, 2543, 2767, 2940, 2859,
+    2914, 2863, 2901, 2903, 2895, 2945, 2905, 2984, 2883, 3196, 2828, 2890, 2861, 2976, 2916, 2894,
+    2847, 2874, 2889, 2921, 2896, 2470, 2873, 2902, 2837, 2879, 3010, 2828, 2868, 2849, 2886, 2859,
+    2827, 2908, 2204, 2895, 2847, 2841, 2878, 2156, 2897, 2830, 2887, 2826, 2872, 2907, 2883, 2917,
+    2861, 2554, 2876, 2585, 2899, 2880, 2915, 2856, 2910, 2885, 2823, 2882, 2833, 2858, 2881, 2818,
+    2254, 3086, 2871, 2827, 2881, 2904, 3049, 2866, 2867, 2880, 2846, 2887, 2868, 2854, 2828, 2890,
+    2862, 2873, 2837, 2863, 2869, 2934, 2941, 2647, 2876, 2843, 2879, 2822, 2906, 2863, 2405, 2802,
+    2491, 2899, 2233, 3112, 2879, 2861, 2955, 2919, 2202, 2948, 2913, 2902, 2984, 3208, 2917, 2876,
+    3008, 2888, 2834, 2853, 2859, 2918, 2844, 2243, 2846, 2799, 2866, 2866, 3045, 2847, 2907, 2923,
+    2886, 2903, 2976, 2913, 2857, 2884, 2891, 2901, 2844, 2890, 2891, 2865, 2945, 2892, 2910, 2916,
+    2876, 2890, 2837, 2877, 2268, 2835, 2220, 2881, 2840, 2874, 2196, 2849, 2939, 2865, 2884, 2851,
+    2623, 2865, 2924, 2910, 2912, 2873, 2899, 2858, 2868, 2903, 2876, 2880, 2861, 2897, 2245, 3066,
+    2872, 2888, 2844, 2379, 2328, 2861, 2826, 2867, 2880, 2186, 2260, 2890, 2890, 2845, 2871, 2882,
+    2849, 3112, 2892, 2918, 2906, 2859, 2869, 2902, 2865, 2834, 2997, 2927, 2896, 2890, 2847, 2866,
+    2883, 2906, 2844, 2852, 2824, 2867, 2250, 2813, 2937, 2869, 2834, 2862, 2888, 2899, 2594, 2877,
+    2871, 2884, 2901, 2860, 2890, 2859, 2855, 2882, 2928, 2912, 2840, 2884, 2369, 3167, 2313, 2837,
+    2992, 2826, 2858, 2849, 2835, 2842, 3010, 2861, 2886, 2868, 2865, 2891, 2868, 2860, 2896, 2860,
+    2857, 2856, 2851, 2965, 2867, 2928, 2916, 2887, 2911, 2843, 2839, 2895, 2884, 2868, 2637, 2879,
+    2890, 2868, 2932, 2845, 2896, 2835, 2924, 2878, 3081, 2175, 2828, 2909, 2839, 2937, 2837, 2878,
+    2851, 2936, 2874, 2859, 2516, 2919, 2679, 2898, 2892, 2920, 2871, 2893, 2249, 2875, 2846, 2420,
+    2625, 2871, 2966, 2866, 2875, 2861, 2403, 2872, 2877, 2865, 2646, 2890, 2917, 2889, 2879, 2861,
+    2830, 2912, 2854, 2919, 2557, 2893, 2867, 2517, 2905, 2834, 2836, 2878, 2952, 2758, 2868, 2878,
+    2887, 2879, 2907, 2883, 2867, 2897, 2842, 2912, 2843, 2890, 2890, 2880, 2891, 2872, 2871, 3042,
+    2902, 2872, 2903, 2927, 2853, 2806, 2919, 2869, 2883, 2839, 2935, 2876, 2870, 2890, 2852, 2811,
+    2824, 2922, 2882, 2925, 3197, 2864, 2876, 2983,
+};
+
+const uint16_t wateringTruth[] = {
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+    2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
+};
+
+// badContact: 2 % of spikes and bursts of 2 to 8 bad conversions
+const uint16_t badContactSamples[] = {
+    3644, 3558, 3603, 2682, 3654, 3639, 3577, 3583, 3596, 3613, 3675, 3579, 3610, 3591, 3590, 3590,
+    3395, 3602, 3620, 3556, 3560, 3625, 3590, 3574, 3589, 3600, 3617, 3560, 3603, 3613, 3631, 2990,
+    3565, 3603, 3632, 3629, 3613, 3214, 3623, 3550, 3576, 3614, 3650, 3568, 3302, 3602, 3554, 3618,
+    3648, 3572, 3618, 3582, 3595, 3616, 3628, 3574, 3642, 3588, 3585, 2246, 2764, 3609, 3537, 3614,
+    3606, 3589, 3633, 3602, 3589, 3616, 3601, 3625, 3640, 3615, 3615, 3581, 3661, 3456, 3601, 3566,
+    3633, 3637, 3577, 3655, 3598, 3600, 3601, 3602, 3592, 3592, 3570, 3635, 3597, 3573, 3547, 3634,
+    3583, 3603, 3562, 3595, 3575, 3648, 3563, 3615, 3625, 3613, 3650, 3534, 3621, 3624, 3659, 3587,
+    3602, 3571, 3597, 3571, 3591, 3627, 3637, 3549, 3548, 3574, 3611, 3636, 3629, 3601, 3587, 3595,
+    3657, 3599, 3568, 3635, 3602, 3586, 3618, 3565, 3641, 3274, 3616, 3603, 3648, 3573, 3615, 3621,
+    3579, 3608, 3626, 3531, 3550, 3627, 3580, 3619, 3576, 3637, 3568, 3618, 3593, 3582, 3585, 3558,
+    3613, 3606, 3604, 3632, 3562, 3542, 3596, 3549, 3595, 3639, 3591, 3637, 3613, 3654, 3638, 3606,
+    3634, 3593, 3603, 3574, 3608, 3612, 3543, 3694, 3596, 3632, 3602, 3632, 3672, 3565, 3590, 3568,
+    3592, 3604, 3565, 3585, 3611, 3652, 3581, 3509, 3591, 3539, 3560, 3595, 3618, 3571, 3568, 3616,
+    3593, 3578, 3620, 3587, 3520, 3554, 3578, 3617, 3535, 3605, 2789, 3655, 3280, 3569, 3604, 3622,
+    3593, 3565, 3547, 3530, 3651, 3582, 3619, 2358, 3569, 3612, 3622, 3569, 3650, 3657, 3587, 3592,
+    3643, 3646, 3561, 3649, 3567, 3600, 3601, 3606, 3630, 3622, 2295, 2281, 3559, 3572, 2715, 3536,
+    3631, 3594, 3614, 3629, 2934, 3602, 3637, 3627, 3620, 3638, 3266, 3617, 3580, 3613, 3618, 3580,
+    3618, 3572, 1971, 3589, 3569, 3582, 3598, 3590, 3574, 3597, 3596, 3592, 3594, 3600, 2598, 3552,
+    3556, 3600, 2862, 3539, 3577, 3611, 3597, 3590, 3588, 3534, 3602, 3559, 3641, 3583, 3594, 3618,
+    3621, 3609, 3562, 3602, 3565, 3610, 3617, 3610, 3578, 3630, 3582, 3595, 3633, 3598, 3607, 3570,
+    3626, 3608, 2815, 3602, 3643, 3583, 3630, 3633, 3278, 3574, 3618, 3581, 3584, 2980, 3578, 3559,
+    3627, 3589, 2693, 3620, 3601, 3594, 3627, 3671, 3553, 3604, 3555, 3636, 3601, 3541, 3702, 3623,
+    3599, 3611, 3621, 3562, 3545, 3626, 3571, 3631, 2122, 3578, 3558, 3601, 3594, 3614, 3601, 3591,
+    3646, 3574, 3664, 3582, 3604, 3572, 3591, 3597, 3600, 3601, 3582, 3610, 3600, 3556, 3579, 3643,
+    3612, 3543, 3553, 3595, 3540, 3636, 3596, 3631, 3582, 3589, 3582, 3635, 2756, 3516, 3578, 3670,
+    3608, 3611, 3616, 3602, 3648, 3624, 3656, 3570, 3574, 3609, 3625, 3634, 3602, 3598, 3550, 3560,
+    3622, 3235, 1360, 3054, 3614, 2049, 2097, 3567, 3275, 3588, 3552, 3592, 3662, 3600, 3576, 3537,
+    3541, 3552, 3564, 3579, 3612, 3573, 3537, 3594, 2894, 3642, 3640, 3584, 2712, 3576, 3588, 3575,
+    3569, 3566, 3593, 3597, 3530, 3578, 3554, 3605, 3556, 3579, 2741, 2957, 3584, 3573, 3601, 3587,
+    3675, 3596, 3607, 3652, 3623, 3622, 3541, 3544, 3581, 3574, 3625, 3575, 3585, 3565, 3613, 3603,
+    3567, 3623, 3624, 3549, 3561, 3556, 3534, 2776, 3577, 3591, 3599, 3006, 3612, 3622, 3600, 3615,
+    3587, 3600, 3576, 3561, 3572, 3553, 3576, 3559, 3536, 3603, 3116, 3608, 3573, 2860, 3597, 3574,
+    3604, 3580, 3586, 3584, 3548, 3597, 3613, 3559, 3551, 3555, 3596, 3546, 3552, 3584, 2712, 3633,
+    3554, 2721, 3613, 3557, 3606, 3609, 3560, 3582, 3590, 3595, 3569, 3585, 3594, 3576, 3397, 3585,
+    3571, 3590, 3640, 3608, 3619, 3554, 3601, 3597, 3633, 3588, 3553, 3604, 3552, 3594, 3589, 3568,
+    3588, 3579, 3581, 3546, 3616, 3650, 3608, 3571, 3561, 3590, 3613, 3550, 3642, 3640, 3591, 3608,
+    3584, 2771, 3665, 3594, 3589, 3580, 3610, 3597, 3592, 3562, 3607, 3621, 3594, 3585, 3198, 3558,
+    3609, 3624, 3553, 3579, 3573, 3575, 3583, 3596,
+};
+
+const uint16_t badContactTruth[] = {
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
+    3600, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592,
+    3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592,
+    3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592,
+    3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592,
+    3592, 3592, 3592, 3592, 3592, 3592, 3592, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+};
+
+struct SoilTrace
+{
+    const char *name;
+    const uint16_t *samples;
+    // 4 times the soil level, on the scale of the samples
+    const uint16_t *truth;
+    size_t length;
+};
+
+const SoilTrace soilTraces[] = {
+    {"steady", steadySamples, steadyTruth, 600},
+    {"watering", wateringSamples, wateringTruth, 600},
+    {"badContact", badContactSamples, badContactTruth, 600},
+};
+
+#endif
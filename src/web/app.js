@@ -0,0 +1,27 @@
+function submitFormAndRedirect() {
+    // Submit the form
+    var form = document.getElementById('reconfigForm');
+    form.submit();
+
+    // Wait for the board to start its access point before going to the configuration page
+    setTimeout(function() {
+        window.location.href = form.dataset.next;
+    }, 3000);
+}
+
+// Replace the readings of the data page as the board sends them
+window.addEventListener('load', function() {
+    if (!window.EventSource) {
+        return;
+    }
+    var source = new EventSource('/events');
+    source.addEventListener('reading', function(event) {
+        var reading = JSON.parse(event.data);
+        for (var key in reading) {
+            var element = document.getElementById(key);
+            if (element) {
+                element.textContent = reading[key];
+            }
+        }
+    });
+});